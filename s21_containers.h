@@ -9,11 +9,22 @@
  *
  * Список классов: list (список), map (словарь), queue (очередь), set
  * (множество), stack (стек), vector (вектор), array (массив), multiset
- * (мультимножество).
+ * (мультимножество), unordered_map, unordered_set, flat_hash_map и
+ * flat_hash_set (хеш-таблицы), concurrent_unordered_map (потокобезопасная
+ * хеш-таблица), concurrent_vector (потокобезопасный вектор только на
+ * добавление), small_vector (вектор со встроенным буфером), mapped_vector
+ * (вектор в отображенном в память файле), segmented_vector (вектор из
+ * сегментов без переноса элементов), soa_vector (записи с поколоночным
+ * хранением полей), bitset_vector (упакованный массив битов), cow_vector
+ * (вектор с копированием при записи), static_vector (вектор фиксированной
+ * емкости без выделения памяти). Параллельные сортировки (parallel_sort,
+ * parallel_stable_sort, radix_sort) используют thread_pool.
  *
  * @section usage_sec Использование
  *
- * В проекте для реализации используется красно-черное дерево
+ * В проекте для реализации используется красно-черное дерево, для
+ * неупорядоченных контейнеров - хеш-таблицы с открытой адресацией
+ * (Robin Hood и групповое SIMD-пробирование)
  *
  * @section contact_sec Контакты
  * Emerosro
@@ -27,12 +38,29 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_H_
 
+#include "s21_containers/bitset_vector/s21_bitset_vector.h"
+#include "s21_containers/concurrent_unordered_map/s21_concurrent_unordered_map.h"
+#include "s21_containers/concurrent_vector/s21_concurrent_vector.h"
+#include "s21_containers/cow_vector/s21_cow_vector.h"
+#include "s21_containers/flat_hash_map/s21_flat_hash_map.h"
+#include "s21_containers/flat_hash_set/s21_flat_hash_set.h"
 #include "s21_containers/list/s21_list.h"
+#include "s21_containers/list/s21_node_pool_allocator.h"
 #include "s21_containers/map/s21_map.h"
+#include "s21_containers/mapped_vector/s21_mapped_vector.h"
+#include "s21_containers/parallel/s21_parallel_sort.h"
 #include "s21_containers/queue/s21_queue.h"
+#include "s21_containers/segmented_vector/s21_segmented_vector.h"
 #include "s21_containers/set/s21_set.h"
+#include "s21_containers/simd/algorithm.h"
+#include "s21_containers/small_vector/s21_small_vector.h"
+#include "s21_containers/soa_vector/s21_soa_vector.h"
 #include "s21_containers/stack/s21_stack.h"
+#include "s21_containers/static_vector/s21_static_vector.h"
 #include "s21_containers/tree/redblacktree.h"
+#include "s21_containers/unordered_map/s21_unordered_map.h"
+#include "s21_containers/unordered_set/s21_unordered_set.h"
+#include "s21_containers/vector/s21_mmap_allocator.h"
 #include "s21_containers/vector/s21_vector.h"
 
 #endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_H_
\ No newline at end of file
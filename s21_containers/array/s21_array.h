@@ -11,18 +11,231 @@
  * функцию как обычный массив в Си. Вторым шаблонным аргументом класса Array
  * является его фактический размер.
  *
+ * Все методы constexpr, поэтому массивы можно создавать, заполнять и
+ * сравнивать во время компиляции (таблицы поиска, небольшие векторы
+ * постоянных). Размер известен на этапе компиляции и не хранится в объекте:
+ * sizeof(array<T, S>) == sizeof(T[S]). Для S не больше kUnrollLimit fill,
+ * swap и сравнения разворачиваются в S отдельных операций без цикла, что
+ * позволяет компилятору собрать их в векторные инструкции.
+ *
+ * Третий параметр задает раскладку элементов в памяти: packed (по
+ * умолчанию, как обычный массив), aligned<N> (начало массива выровнено на N
+ * байт, например 32 для загрузок AVX) и cacheline_padded (каждый элемент в
+ * своей кэш-линии, чтобы счетчики разных потоков не делили линию). У
+ * cacheline_padded элементы не лежат подряд: итераторы шагают через
+ * stride() байт, а data() недоступен.
+ *
  * @tparam T Тип элементов, хранимых в массиве.
  * @tparam Size Фиксированный размер массива.
  */
 
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_ARRAY_S21_ARRAY_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_ARRAY_S21_ARRAY_H_
-#include <algorithm>
 #include <cstddef>
+#include <initializer_list>
+#include <iterator>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 namespace s21 {
-template <typename T, long unsigned S>
+
+/// Раскладка по умолчанию: элементы подряд, как в T[S].
+struct packed {};
+
+/// Элементы подряд, начало массива выровнено на Alignment байт.
+template <std::size_t Alignment>
+struct aligned {};
+
+/// Каждый элемент занимает отдельную кэш-линию.
+struct cacheline_padded {};
+
+namespace array_detail {
+
+inline constexpr std::size_t kCacheLineSize = 64;
+
+template <typename T, std::size_t Alignment>
+struct alignas(Alignment) PaddedSlot {
+  T value{};
+};
+
+/**
+ * @brief Описание раскладки: тип ячейки, в которой лежит элемент,
+ * выравнивание начала массива и доступ к элементу в ячейке.
+ */
+template <typename Layout, typename T>
+struct LayoutTraits;
+
+template <typename T>
+struct LayoutTraits<packed, T> {
+  using Slot = T;
+  static constexpr std::size_t kAlignment = alignof(T);
+  static constexpr bool kContiguous = true;
+  static constexpr T &get(Slot &slot) { return slot; }
+  static constexpr const T &get(const Slot &slot) { return slot; }
+};
+
+template <std::size_t Alignment, typename T>
+struct LayoutTraits<aligned<Alignment>, T> : LayoutTraits<packed, T> {
+  static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0,
+                "array: alignment must be a power of two");
+  static constexpr std::size_t kAlignment =
+      Alignment > alignof(T) ? Alignment : alignof(T);
+};
+
+template <typename T>
+struct LayoutTraits<cacheline_padded, T> {
+  static constexpr std::size_t kAlignment =
+      kCacheLineSize > alignof(T) ? kCacheLineSize : alignof(T);
+  using Slot = PaddedSlot<T, kAlignment>;
+  static constexpr bool kContiguous = false;
+  static constexpr T &get(Slot &slot) { return slot.value; }
+  static constexpr const T &get(const Slot &slot) { return slot.value; }
+};
+
+/**
+ * @brief Итератор произвольного доступа по ячейкам с промежутками между
+ * элементами; Slot константный у константного итератора.
+ */
+template <typename Slot, typename Value>
+class SlotIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value *;
+  using reference = Value &;
+
+  constexpr SlotIterator() = default;
+  constexpr explicit SlotIterator(Slot *slot) : slot_(slot) {}
+
+  template <typename OtherSlot, typename OtherValue,
+            typename = std::enable_if_t<
+                std::is_convertible_v<OtherSlot *, Slot *> &&
+                !std::is_same_v<OtherSlot, Slot>>>
+  constexpr SlotIterator(const SlotIterator<OtherSlot, OtherValue> &other)
+      : slot_(other.base()) {}
+
+  constexpr Slot *base() const { return slot_; }
+
+  constexpr reference operator*() const { return slot_->value; }
+  constexpr pointer operator->() const { return &slot_->value; }
+  constexpr reference operator[](difference_type n) const {
+    return slot_[n].value;
+  }
+
+  constexpr SlotIterator &operator++() {
+    ++slot_;
+    return *this;
+  }
+  constexpr SlotIterator operator++(int) {
+    SlotIterator copy = *this;
+    ++slot_;
+    return copy;
+  }
+  constexpr SlotIterator &operator--() {
+    --slot_;
+    return *this;
+  }
+  constexpr SlotIterator operator--(int) {
+    SlotIterator copy = *this;
+    --slot_;
+    return copy;
+  }
+  constexpr SlotIterator &operator+=(difference_type n) {
+    slot_ += n;
+    return *this;
+  }
+  constexpr SlotIterator &operator-=(difference_type n) {
+    slot_ -= n;
+    return *this;
+  }
+  constexpr SlotIterator operator+(difference_type n) const {
+    return SlotIterator(slot_ + n);
+  }
+  friend constexpr SlotIterator operator+(difference_type n,
+                                          const SlotIterator &it) {
+    return it + n;
+  }
+  constexpr SlotIterator operator-(difference_type n) const {
+    return SlotIterator(slot_ - n);
+  }
+  constexpr difference_type operator-(const SlotIterator &other) const {
+    return slot_ - other.slot_;
+  }
+
+  constexpr bool operator==(const SlotIterator &other) const {
+    return slot_ == other.slot_;
+  }
+  constexpr bool operator!=(const SlotIterator &other) const {
+    return slot_ != other.slot_;
+  }
+  constexpr bool operator<(const SlotIterator &other) const {
+    return slot_ < other.slot_;
+  }
+  constexpr bool operator>(const SlotIterator &other) const {
+    return slot_ > other.slot_;
+  }
+  constexpr bool operator<=(const SlotIterator &other) const {
+    return slot_ <= other.slot_;
+  }
+  constexpr bool operator>=(const SlotIterator &other) const {
+    return slot_ >= other.slot_;
+  }
+
+ private:
+  Slot *slot_ = nullptr;
+};
+
+/// Наибольший размер, для которого поэлементные операции разворачиваются.
+inline constexpr std::size_t kUnrollLimit = 16;
+
+template <typename F, std::size_t... I>
+constexpr void forEachIndexUnrolled(F &f, std::index_sequence<I...>) {
+  (f(I), ...);
+}
+
+/**
+ * @brief Вызывает f(i) для i = 0..S-1: развернуто для малых S, иначе
+ * циклом.
+ */
+template <std::size_t S, typename F>
+constexpr void forEachIndex(F &&f) {
+  if constexpr (S <= kUnrollLimit) {
+    forEachIndexUnrolled(f, std::make_index_sequence<S>{});
+  } else {
+    for (std::size_t i = 0; i < S; ++i) {
+      f(i);
+    }
+  }
+}
+
+template <typename P, std::size_t... I>
+constexpr bool allOfUnrolled(P &pred, std::index_sequence<I...>) {
+  return (static_cast<bool>(pred(I)) && ...);
+}
+
+/**
+ * @brief Истинен ли pred(i) для всех i = 0..S-1. Проверка идет до первого
+ * ложного pred(i); для малых S без цикла.
+ */
+template <std::size_t S, typename P>
+constexpr bool allOf(P &&pred) {
+  if constexpr (S == 0) {
+    return true;
+  } else if constexpr (S <= kUnrollLimit) {
+    return allOfUnrolled(pred, std::make_index_sequence<S>{});
+  } else {
+    for (std::size_t i = 0; i < S; ++i) {
+      if (!pred(i)) return false;
+    }
+    return true;
+  }
+}
+
+}  // namespace array_detail
+
+template <typename T, long unsigned S, typename Layout = packed>
 
 /**
  * @brief Класс контейнера с фиксированным размером.
@@ -32,83 +245,63 @@ template <typename T, long unsigned S>
  *
  * @tparam T Тип элементов, хранимых в массиве.
  * @tparam S Максимальное количество элементов в массиве.
+ * @tparam Layout Раскладка элементов: packed, aligned<N> или
+ * cacheline_padded.
  */
 
 class array {
+  using Traits = array_detail::LayoutTraits<Layout, T>;
+  using Slot = typename Traits::Slot;
+
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
-  using iterator = T *;
-  using const_iterator = const T *;
+  using iterator =
+      std::conditional_t<Traits::kContiguous, T *,
+                         array_detail::SlotIterator<Slot, T>>;
+  using const_iterator =
+      std::conditional_t<Traits::kContiguous, const T *,
+                         array_detail::SlotIterator<const Slot, const T>>;
   using size_type = size_t;
 
   /**
-   * @brief Конструктор по умолчанию, создает пустой массив.
+   * @brief Конструктор по умолчанию, создает массив из S элементов,
+   * инициализированных по умолчанию (нулями для арифметических типов).
    */
-  array() {}
+  constexpr array() = default;
 
   /**
    * @brief Конструктор с инициализацией через список инициализации, создает
    * массив, инициализированный с использованием std::initializer_list.
    *
+   * Элементы, для которых не хватило значений, остаются
+   * инициализированными по умолчанию.
+   *
    * @param items Список инициализации элементов для инициализации массива.
+   * @throws std::length_error если значений больше S (во время компиляции -
+   * ошибка компиляции).
    */
-  explicit array(std::initializer_list<value_type> const &items) {
+  explicit constexpr array(std::initializer_list<value_type> const &items) {
     if (items.size() > S) {
+      throw std::length_error("array: " + std::to_string(items.size()) +
+                              " initializers for size " + std::to_string(S));
     }
-    int i = 0;
+    size_type i = 0;
     for (const_reference item : items) {
-      data_[i] = item;
+      Traits::get(slots_[i]) = item;
       ++i;
     }
   }
 
   /**
-   * @brief Конструктор копирования.
-   *
-   * @param a Другой массив для копирования элементов.
-   */
-  array(const array &a) {
-    if (a.size_ == size_) {
-      for (size_type i = 0; i < size_; ++i) {
-        data_[i] = a.data_[i];
-      }
-    }
-  }
-
-  /**
-   * @brief Конструктор перемещения.
-   *
-   * @param a Другой массив для перемещения элементов.
+   * @brief Копирование и перемещение поэлементные; для тривиально
+   * копируемых T массив тоже тривиально копируемый.
    */
-  array(array &&a) {
-    if (a.size_ == size_) {
-      for (size_type i = 0; i < size_; ++i) {
-        data_[i] = std::move(a.data_[i]);
-      }
-    }
-  }
-
-  /**
-   * @brief Деструктор.
-   */
-  ~array() {}
-
-  /**
-   * @brief Перегрузка оператора присваивания для перемещения объекта.
-   *
-   * @param a Другой массив для перемещения элементов.
-   * @return Ссылка на измененный массив.
-   */
-  array &operator=(array &&a) {
-    if (a.size_ == size_) {
-      for (size_type i = 0; i < size_; ++i) {
-        data_[i] = std::move(a.data_[i]);
-      }
-    }
-    return *this;
-  }
+  constexpr array(const array &a) = default;
+  constexpr array(array &&a) = default;
+  constexpr array &operator=(const array &a) = default;
+  constexpr array &operator=(array &&a) = default;
 
   /**
    * @brief Доступ к указанному элементу с проверкой границ.
@@ -120,13 +313,14 @@ class array {
    * @return Ссылка на элемент по указанной позиции.
    * @throws std::out_of_range если `pos` превышает размер массива.
    */
-  reference at(size_type pos) {
-    if (pos >= size_) {
-      throw std::out_of_range("array::at: __n (which is " +
-                              std::to_string(pos) + ") >= _Nm (which is " +
-                              std::to_string(this->size_) + ")");
-    }
-    return data_[pos];
+  constexpr reference at(size_type pos) {
+    checkIndex(pos);
+    return Traits::get(slots_[pos]);
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    checkIndex(pos);
+    return Traits::get(slots_[pos]);
   }
 
   /**
@@ -138,34 +332,56 @@ class array {
    * @param pos Позиция элемента в массиве.
    * @return Ссылка на элемент по указанной позиции.
    */
-  reference operator[](size_type pos) { return data_[pos]; }
+  constexpr reference operator[](size_type pos) {
+    return Traits::get(slots_[pos]);
+  }
+  constexpr const_reference operator[](size_type pos) const {
+    return Traits::get(slots_[pos]);
+  }
 
   /**
    * @brief Доступ к первому элементу массива.
    *
    * Этот метод позволяет получить доступ к первому элементу массива.
    *
-   * @return Константная ссылка на первый элемент массива.
+   * @return Ссылка на первый элемент массива (константная у константного
+   * массива).
    */
-  const_reference front() { return data_[0]; }
+  constexpr reference front() { return Traits::get(slots_[0]); }
+  constexpr const_reference front() const { return Traits::get(slots_[0]); }
 
   /**
    * @brief Доступ к последнему элементу массива.
    *
    * Этот метод позволяет получить доступ к последнему элементу массива.
    *
-   * @return Константная ссылка на последний элемент массива.
+   * @return Ссылка на последний элемент массива (константная у константного
+   * массива).
    */
-  const_reference back() { return data_[size_ - 1]; }
+  constexpr reference back() { return Traits::get(slots_[S - 1]); }
+  constexpr const_reference back() const {
+    return Traits::get(slots_[S - 1]);
+  }
 
   /**
    * @brief Получение указателя на внутренний массив данных.
    *
    * Этот метод возвращает указатель на внутренний массив данных контейнера.
    *
+   * Доступен только для раскладок, в которых элементы лежат подряд.
+   *
    * @return Указатель на внутренний массив данных.
    */
-  iterator data() { return data_; }
+  constexpr T *data() {
+    static_assert(Traits::kContiguous,
+                  "array::data: cacheline_padded elements are not contiguous");
+    return slots_;
+  }
+  constexpr const T *data() const {
+    static_assert(Traits::kContiguous,
+                  "array::data: cacheline_padded elements are not contiguous");
+    return slots_;
+  }
 
   /**
    * @brief Получение итератора, указывающего на начало массива.
@@ -174,7 +390,9 @@ class array {
    *
    * @return Итератор, указывающий на начало массива.
    */
-  iterator begin() { return data_; }
+  constexpr iterator begin() { return iterator(slots_); }
+  constexpr const_iterator begin() const { return const_iterator(slots_); }
+  constexpr const_iterator cbegin() const { return const_iterator(slots_); }
 
   /**
    * @brief Получение итератора, указывающего на конец массива.
@@ -183,7 +401,9 @@ class array {
    *
    * @return Итератор, указывающий на конец массива.
    */
-  iterator end() { return data_ + size_; }
+  constexpr iterator end() { return iterator(slots_ + S); }
+  constexpr const_iterator end() const { return const_iterator(slots_ + S); }
+  constexpr const_iterator cend() const { return const_iterator(slots_ + S); }
 
   /**
    * @brief Проверка, является ли массив пустым.
@@ -192,13 +412,7 @@ class array {
    *
    * @return true, если массив пуст; в противном случае - false.
    */
-  bool empty() {
-    bool result = true;
-    if (size_) {
-      result = false;
-    }
-    return result;
-  }
+  constexpr bool empty() const noexcept { return S == 0; }
 
   /**
    * @brief Получение текущего размера массива.
@@ -208,7 +422,7 @@ class array {
    *
    * @return Размер массива.
    */
-  size_type size() { return size_; }
+  constexpr size_type size() const noexcept { return S; }
 
   /**
    * @brief Получение максимально возможного размера массива.
@@ -218,20 +432,30 @@ class array {
    *
    * @return Максимально возможный размер массива.
    */
-  size_type max_size() { return size_; }
+  constexpr size_type max_size() const noexcept { return S; }
+
+  /// Расстояние в байтах между соседними элементами.
+  static constexpr size_type stride() noexcept { return sizeof(Slot); }
+
+  /// Выравнивание начала массива в байтах.
+  static constexpr size_type alignment() noexcept {
+    return Traits::kAlignment;
+  }
 
   /**
    * @brief Обмен содержимого массива с другим массивом.
    *
    * Этот метод позволяет обменять содержимое текущего массива с содержимым
-   * другого массива, при условии, что их размеры равны.
+   * другого массива того же размера.
    *
    * @param other Другой массив, с которым будет выполнен обмен.
    */
-  void swap(array &other) {
-    if (other.size_ == size_) {
-      std::swap(other.data_, data_);
-    }
+  constexpr void swap(array &other) {
+    array_detail::forEachIndex<S>([this, &other](size_type i) {
+      value_type tmp = std::move((*this)[i]);
+      (*this)[i] = std::move(other[i]);
+      other[i] = std::move(tmp);
+    });
   }
 
   /**
@@ -241,11 +465,65 @@ class array {
    *
    * @param value Значение, которым будет заполнен весь массив.
    */
-  void fill(const_reference value) { std::fill(data_, data_ + size_, value); }
+  constexpr void fill(const_reference value) {
+    array_detail::forEachIndex<S>(
+        [this, &value](size_type i) { (*this)[i] = value; });
+  }
 
  private:
-  value_type data_[S];  // Основной массив для хранения элементов
-  size_type size_ = S;  // Максимальное количество элементов в массиве.
+  // Основной массив для хранения элементов; инициализатор нужен, чтобы
+  // конструкторы были constexpr в C++17
+  alignas(Traits::kAlignment) Slot slots_[S]{};
+
+  constexpr void checkIndex(size_type pos) const {
+    if (pos >= S) {
+      throw std::out_of_range("array::at: __n (which is " +
+                              std::to_string(pos) + ") >= _Nm (which is " +
+                              std::to_string(S) + ")");
+    }
+  }
 };
+
+/**
+ * @brief Поэлементное сравнение массивов одного размера.
+ */
+template <typename T, long unsigned S, typename L>
+constexpr bool operator==(const array<T, S, L> &a, const array<T, S, L> &b) {
+  return array_detail::allOf<S>(
+      [&a, &b](std::size_t i) { return a[i] == b[i]; });
+}
+
+template <typename T, long unsigned S, typename L>
+constexpr bool operator!=(const array<T, S, L> &a, const array<T, S, L> &b) {
+  return !(a == b);
+}
+
+/**
+ * @brief Лексикографическое сравнение массивов одного размера.
+ */
+template <typename T, long unsigned S, typename L>
+constexpr bool operator<(const array<T, S, L> &a, const array<T, S, L> &b) {
+  for (std::size_t i = 0; i < S; ++i) {
+    if (a[i] < b[i]) return true;
+    if (b[i] < a[i]) return false;
+  }
+  return false;
+}
+
+template <typename T, long unsigned S, typename L>
+constexpr bool operator>(const array<T, S, L> &a, const array<T, S, L> &b) {
+  return b < a;
+}
+
+template <typename T, long unsigned S, typename L>
+constexpr bool operator<=(const array<T, S, L> &a, const array<T, S, L> &b) {
+  return !(b < a);
+}
+
+template <typename T, long unsigned S, typename L>
+constexpr bool operator>=(const array<T, S, L> &a, const array<T, S, L> &b) {
+  return !(a < b);
+}
+
 }  // namespace s21
-#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_ARRAY_S21_ARRAY_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_ARRAY_S21_ARRAY_H_
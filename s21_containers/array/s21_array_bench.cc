@@ -0,0 +1,86 @@
+// Бенчмарк поэлементных операций над маленькими массивами: s21::array
+// (развернутые fill, swap и сравнение) против std::array. Для размеров 4,
+// 8, 16 и 64 элемента float выполняется [повторов] раз каждая операция
+// над пулом из 1024 массивов; печатается время в миллисекундах.
+//
+// Запуск: ./bench.out [повторов]
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "s21_array.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::size_t kPool = 1024;
+
+template <typename F>
+double Ms(F f) {
+  auto start = Clock::now();
+  std::size_t result = f();
+  double ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  if (result == 42) std::printf("\n");  // не дает выбросить замер
+  return ms;
+}
+
+template <typename Array>
+void Measure(const char *name, std::size_t rounds) {
+  std::vector<Array> a(kPool), b(kPool);
+  for (std::size_t i = 0; i < kPool; ++i) {
+    a[i].fill(static_cast<float>(i % 7));
+    b[i].fill(static_cast<float>(i % 5));
+  }
+  double fill_ms = Ms([&] {
+    for (std::size_t r = 0; r < rounds; ++r) {
+      for (std::size_t i = 0; i < kPool; ++i) {
+        a[i].fill(static_cast<float>(r + i));
+      }
+    }
+    return static_cast<std::size_t>(a[3][0]);
+  });
+  double swap_ms = Ms([&] {
+    for (std::size_t r = 0; r < rounds; ++r) {
+      for (std::size_t i = 0; i < kPool; ++i) a[i].swap(b[i]);
+    }
+    return static_cast<std::size_t>(b[5][0]);
+  });
+  double equal_ms = Ms([&] {
+    std::size_t equal = 0;
+    for (std::size_t r = 0; r < rounds; ++r) {
+      for (std::size_t i = 0; i < kPool; ++i) {
+        equal += a[i] == b[(i + r) % kPool];
+      }
+    }
+    return equal;
+  });
+  std::printf("  %-22s %10.2f %10.2f %10.2f\n", name, fill_ms, swap_ms,
+              equal_ms);
+}
+
+template <std::size_t S>
+void Compare(std::size_t rounds) {
+  char name[32];
+  std::snprintf(name, sizeof(name), "s21::array<float, %zu>", S);
+  Measure<s21::array<float, S>>(name, rounds);
+  std::snprintf(name, sizeof(name), "std::array<float, %zu>", S);
+  Measure<std::array<float, S>>(name, rounds);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+  std::printf("%zu rounds over %zu arrays, ms\n", rounds, kPool);
+  std::printf("  %-22s %10s %10s %10s\n", "", "fill", "swap", "==");
+  Compare<4>(rounds);
+  Compare<8>(rounds);
+  Compare<16>(rounds);
+  Compare<64>(rounds);
+  return 0;
+}
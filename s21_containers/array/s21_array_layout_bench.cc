@@ -0,0 +1,71 @@
+// Бенчмарк ложного разделения кэш-линий: каждый поток увеличивает свой
+// атомарный счетчик в s21::array<std::atomic<uint64_t>, N> с раскладкой
+// packed (соседние счетчики в одной линии) и cacheline_padded (у каждого
+// счетчика своя линия). Печатается время в миллисекундах и миллионы
+// инкрементов в секунду. Разница видна только на нескольких ядрах.
+//
+// Запуск: ./bench.out [инкрементов на поток] [потоков]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "s21_array.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::size_t kMaxThreads = 64;
+
+template <typename Counters>
+double Run(Counters &counters, std::size_t increments, std::size_t threads) {
+  auto start = Clock::now();
+  std::vector<std::thread> workers;
+  for (std::size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&counters, increments, t] {
+      for (std::size_t i = 0; i < increments; ++i) {
+        counters[t].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename Counters>
+void Report(const char *name, std::size_t increments, std::size_t threads) {
+  // Счетчики в куче: cacheline_padded на 64 потока занимает 4 КиБ
+  auto counters = std::make_unique<Counters>();
+  double ms = Run(*counters, increments, threads);
+  std::uint64_t total = 0;
+  for (std::size_t t = 0; t < threads; ++t) total += (*counters)[t].load();
+  if (total != increments * threads) std::printf("lost increments\n");
+  std::printf("  %-18s %10.1f %12.1f\n", name, ms,
+              static_cast<double>(total) / ms / 1000.0);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t increments =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  std::size_t threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                 : std::thread::hardware_concurrency();
+  if (threads < 2) threads = 2;
+  if (threads > kMaxThreads) threads = kMaxThreads;
+
+  using Counter = std::atomic<std::uint64_t>;
+  std::printf("%zu threads x %zu increments\n", threads, increments);
+  std::printf("  %-18s %10s %12s\n", "", "ms", "M incr/s");
+  Report<s21::array<Counter, kMaxThreads>>("packed", increments, threads);
+  Report<s21::array<Counter, kMaxThreads, s21::cacheline_padded>>(
+      "cacheline_padded", increments, threads);
+  return 0;
+}
@@ -2,7 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
 TEST(Array, test_1) {
   s21::array<int, 5> arr_s21;
   std::array<int, 5> arr_std;
@@ -122,4 +129,110 @@ TEST(Array, test_13) {
   EXPECT_EQ(arr_2[2], 3);
   EXPECT_EQ(arr_2[3], 4);
   EXPECT_EQ(arr_2[4], 5);
-}
\ No newline at end of file
+}
+
+namespace {
+
+// Таблица квадратов, построенная во время компиляции
+constexpr s21::array<int, 8> Squares() {
+  s21::array<int, 8> table;
+  for (size_t i = 0; i < table.size(); ++i) {
+    table[i] = static_cast<int>(i * i);
+  }
+  return table;
+}
+
+constexpr s21::array<int, 3> Swapped() {
+  s21::array<int, 3> a{1, 2, 3};
+  s21::array<int, 3> b{4, 5, 6};
+  a.swap(b);
+  a.front() = 0;
+  return a;
+}
+
+constexpr s21::array<long, 40> Filled(long value) {
+  s21::array<long, 40> a;
+  a.fill(value);
+  a.back() = -1;
+  return a;
+}
+
+constexpr s21::array<int, 8> kSquares = Squares();
+static_assert(kSquares[7] == 49);
+static_assert(kSquares.at(3) == 9);
+static_assert(kSquares.front() == 0 && kSquares.back() == 49);
+static_assert(*(kSquares.end() - 2) == 36);
+static_assert(kSquares.size() == 8 && !kSquares.empty());
+static_assert(Swapped() == s21::array<int, 3>{0, 5, 6});
+static_assert(Swapped() != s21::array<int, 3>{4, 5, 6});
+static_assert(s21::array<int, 3>{1, 2} < s21::array<int, 3>{1, 3});
+static_assert(s21::array<int, 3>{1, 2, 3} >= s21::array<int, 3>{1, 2, 3});
+static_assert(Filled(7)[38] == 7 && Filled(7)[39] == -1);
+static_assert(sizeof(s21::array<int, 5>) == sizeof(int[5]));
+
+}  // namespace
+
+TEST(Array, test_14) {
+  const s21::array<int, 3> arr{1, 2, 3};
+  s21::array<int, 3> copy;
+  copy = arr;
+  copy.front() = 10;
+  copy.back() += 10;
+  EXPECT_EQ(copy, (s21::array<int, 3>{10, 2, 13}));
+  EXPECT_LT(arr, copy);
+  EXPECT_EQ(arr.at(2), 3);
+  EXPECT_THROW(arr.at(3), std::out_of_range);
+  EXPECT_THROW((s21::array<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(Array, test_15) {
+  s21::array<std::string, 20> a;
+  s21::array<std::string, 20> b;
+  a.fill("a");
+  b.fill("b");
+  b[19] = "z";
+  a.swap(b);
+  EXPECT_EQ(a[0], "b");
+  EXPECT_EQ(a[19], "z");
+  EXPECT_EQ(b[19], "a");
+  EXPECT_TRUE(a > b);
+  EXPECT_EQ(kSquares[5], 25);
+}
+
+TEST(Array, test_16) {
+  using Padded = s21::array<long, 4, s21::cacheline_padded>;
+  static_assert(sizeof(Padded) == 4 * 64 && alignof(Padded) == 64);
+  static_assert(Padded::stride() == 64);
+  static_assert(Padded{1, 2, 3, 4}.back() == 4);
+
+  Padded arr{3, 1, 4, 2};
+  EXPECT_EQ(reinterpret_cast<const char *>(&arr[1]) -
+                reinterpret_cast<const char *>(&arr[0]),
+            64);
+  std::sort(arr.begin(), arr.end());
+  EXPECT_EQ(arr, (Padded{1, 2, 3, 4}));
+  const Padded &view = arr;
+  EXPECT_EQ(std::accumulate(view.begin(), view.end(), 0L), 10);
+  EXPECT_EQ(view.cend() - view.cbegin(), 4);
+  Padded::const_iterator it = arr.begin();
+  EXPECT_EQ(it[2], 3);
+
+  s21::array<float, 8, s21::aligned<32>> simd;
+  static_assert(decltype(simd)::alignment() == 32);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(simd.data()) % 32, 0U);
+  EXPECT_EQ(simd.stride(), sizeof(float));
+}
+
+TEST(Array, test_17) {
+  s21::array<std::atomic<std::uint64_t>, 4, s21::cacheline_padded> counters;
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < counters.size(); ++t) {
+    threads.emplace_back([&counters, t] {
+      for (int i = 0; i < 10000; ++i) {
+        counters[t].fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  for (const auto &counter : counters) EXPECT_EQ(counter.load(), 10000U);
+}
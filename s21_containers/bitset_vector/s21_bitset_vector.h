@@ -0,0 +1,450 @@
+/**
+ * @file s21_bitset_vector.h
+ * @brief Динамический массив битов, по 64 бита в слове.
+ *
+ * Класс bitset_vector занимает бит на элемент вместо байта у
+ * s21::vector<bool>. Подсчет, поиск установленных битов и побитовые
+ * операции между векторами идут по целым словам: count() использует
+ * POPCNT, поиск - счетчик нулевых младших битов, а and/or/xor - ядра
+ * s21::simd::transform по 256 бит за инструкцию. Доступ к отдельным
+ * битам и итераторы работают через прокси-ссылку, как у std::vector<bool>.
+ *
+ * Биты старшего слова за пределами size() всегда нулевые, поэтому
+ * пословные операции не проверяют границу.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_BITSET_VECTOR_S21_BITSET_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_BITSET_VECTOR_S21_BITSET_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "../simd/algorithm.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+namespace bitset_detail {
+
+#if S21_SIMD_AVX2
+S21_TARGET_POPCNT inline std::size_t countPopcnt(const std::uint64_t *first,
+                                                 const std::uint64_t *last) {
+  std::size_t total = 0;
+  for (; first != last; ++first) {
+    total += static_cast<std::size_t>(__builtin_popcountll(*first));
+  }
+  return total;
+}
+#endif
+
+/// Количество установленных битов в словах [first, last).
+inline std::size_t countBits(const std::uint64_t *first,
+                             const std::uint64_t *last) {
+#if S21_SIMD_AVX2
+  if (simd::has_popcnt()) return countPopcnt(first, last);
+#endif
+  std::size_t total = 0;
+  for (; first != last; ++first) {
+    total += static_cast<std::size_t>(__builtin_popcountll(*first));
+  }
+  return total;
+}
+
+}  // namespace bitset_detail
+
+/**
+ * @class bitset_vector
+ * @brief Упакованный динамический массив логических значений.
+ */
+class bitset_vector {
+ public:
+  using value_type = bool;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using word_type = std::uint64_t;
+  using const_reference = bool;
+
+  /// Количество битов в слове.
+  static constexpr size_type bits_per_word = 64;
+  /// Результат find_first/find_next, если бит не найден.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  /**
+   * @brief Прокси-ссылка на бит: слово и маска.
+   */
+  class reference {
+   public:
+    reference(word_type *word, word_type mask) : word_(word), mask_(mask) {}
+    reference(const reference &) = default;
+
+    operator bool() const { return (*word_ & mask_) != 0; }
+    bool operator~() const { return !static_cast<bool>(*this); }
+
+    reference &operator=(bool value) {
+      if (value) {
+        *word_ |= mask_;
+      } else {
+        *word_ &= ~mask_;
+      }
+      return *this;
+    }
+
+    reference &operator=(const reference &other) {
+      return *this = static_cast<bool>(other);
+    }
+
+    void flip() { *word_ ^= mask_; }
+
+   private:
+    word_type *word_;
+    word_type mask_;
+  };
+
+  /**
+   * @brief Итератор произвольного доступа по битам.
+   *
+   * @tparam Const Если true, разыменование возвращает bool.
+   */
+  template <bool Const>
+  class IteratorBase {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = bool;
+    using reference =
+        std::conditional_t<Const, bool, bitset_vector::reference>;
+    using pointer = void;
+    using iterator_category = std::random_access_iterator_tag;
+    using OwnerPtr =
+        std::conditional_t<Const, const bitset_vector *, bitset_vector *>;
+
+    IteratorBase() = default;
+    IteratorBase(OwnerPtr owner, size_type index)
+        : owner_(owner), index_(index) {}
+    // Неконстантный итератор неявно приводится к константному
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorBase(const IteratorBase<OtherConst> &other)
+        : owner_(other.owner()), index_(other.index()) {}
+
+    reference operator*() const { return (*owner_)[index_]; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    IteratorBase &operator++() {
+      ++index_;
+      return *this;
+    }
+    IteratorBase operator++(int) {
+      IteratorBase tmp = *this;
+      ++index_;
+      return tmp;
+    }
+    IteratorBase &operator--() {
+      --index_;
+      return *this;
+    }
+    IteratorBase operator--(int) {
+      IteratorBase tmp = *this;
+      --index_;
+      return tmp;
+    }
+    IteratorBase &operator+=(difference_type n) {
+      index_ = static_cast<size_type>(static_cast<difference_type>(index_) +
+                                      n);
+      return *this;
+    }
+    IteratorBase &operator-=(difference_type n) { return *this += -n; }
+    friend IteratorBase operator+(IteratorBase it, difference_type n) {
+      return it += n;
+    }
+    friend IteratorBase operator+(difference_type n, IteratorBase it) {
+      return it += n;
+    }
+    friend IteratorBase operator-(IteratorBase it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const IteratorBase &a,
+                                     const IteratorBase &b) {
+      return static_cast<difference_type>(a.index_) -
+             static_cast<difference_type>(b.index_);
+    }
+
+    bool operator==(const IteratorBase &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const IteratorBase &other) const {
+      return index_ != other.index_;
+    }
+    bool operator<(const IteratorBase &other) const {
+      return index_ < other.index_;
+    }
+    bool operator>(const IteratorBase &other) const {
+      return index_ > other.index_;
+    }
+    bool operator<=(const IteratorBase &other) const {
+      return index_ <= other.index_;
+    }
+    bool operator>=(const IteratorBase &other) const {
+      return index_ >= other.index_;
+    }
+
+    OwnerPtr owner() const { return owner_; }
+    size_type index() const { return index_; }
+
+   private:
+    OwnerPtr owner_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  using iterator = IteratorBase<false>;
+  using const_iterator = IteratorBase<true>;
+
+  bitset_vector() = default;
+
+  explicit bitset_vector(size_type n, bool value = false) { resize(n, value); }
+
+  explicit bitset_vector(std::initializer_list<bool> const &items) {
+    reserve(items.size());
+    for (bool item : items) {
+      push_back(item);
+    }
+  }
+
+  reference at(size_type pos) {
+    checkIndex(pos);
+    return (*this)[pos];
+  }
+
+  bool at(size_type pos) const {
+    checkIndex(pos);
+    return test(pos);
+  }
+
+  reference operator[](size_type pos) {
+    return reference(words_.data() + pos / bits_per_word, maskOf(pos));
+  }
+  bool operator[](size_type pos) const { return test(pos); }
+  reference front() { return (*this)[0]; }
+  bool front() const { return test(0); }
+  reference back() { return (*this)[size_ - 1]; }
+  bool back() const { return test(size_ - 1); }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cbegin() const { return const_iterator(this, 0); }
+  const_iterator cend() const { return const_iterator(this, size_); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return words_.capacity() * bits_per_word; }
+
+  /// Слова с битами; биты за size() в последнем слове нулевые.
+  const word_type *data() const { return words_.data(); }
+  size_type word_count() const { return words_.size(); }
+
+  void reserve(size_type bits) { words_.reserve(wordsFor(bits)); }
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  void clear() {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void resize(size_type n, bool value = false) {
+    if (n > size_ && value && size_ % bits_per_word != 0) {
+      words_[words_.size() - 1] |= ~word_type{0} << (size_ % bits_per_word);
+    }
+    words_.resize(wordsFor(n), value ? ~word_type{0} : word_type{0});
+    size_ = n;
+    clearTail();
+  }
+
+  void push_back(bool value) {
+    if (size_ % bits_per_word == 0) words_.push_back(0);
+    if (value) words_[size_ / bits_per_word] |= maskOf(size_);
+    ++size_;
+  }
+
+  void pop_back() {
+    --size_;
+    if (size_ % bits_per_word == 0) {
+      words_.pop_back();
+    } else {
+      words_[size_ / bits_per_word] &= ~maskOf(size_);
+    }
+  }
+
+  void swap(bitset_vector &other) {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  bool test(size_type pos) const {
+    return (words_[pos / bits_per_word] & maskOf(pos)) != 0;
+  }
+
+  bitset_vector &set(size_type pos, bool value = true) {
+    (*this)[pos] = value;
+    return *this;
+  }
+
+  bitset_vector &reset(size_type pos) { return set(pos, false); }
+
+  bitset_vector &flip(size_type pos) {
+    words_[pos / bits_per_word] ^= maskOf(pos);
+    return *this;
+  }
+
+  /// Устанавливает все биты.
+  bitset_vector &set() {
+    simd::fill(words_, ~word_type{0});
+    clearTail();
+    return *this;
+  }
+
+  /// Сбрасывает все биты.
+  bitset_vector &reset() {
+    simd::fill(words_, word_type{0});
+    return *this;
+  }
+
+  /// Инвертирует все биты.
+  bitset_vector &flip() {
+    simd::transform(words_.data(), words_.data() + words_.size(),
+                    words_.data(), std::bit_not<>());
+    clearTail();
+    return *this;
+  }
+
+  /// Количество установленных битов.
+  size_type count() const {
+    return bitset_detail::countBits(words_.data(),
+                                    words_.data() + words_.size());
+  }
+
+  bool any() const {
+    const word_type *last = words_.data() + words_.size();
+    return std::find_if(words_.data(), last,
+                        [](word_type w) { return w != 0; }) != last;
+  }
+  bool none() const { return !any(); }
+  bool all() const { return count() == size_; }
+
+  /// Индекс первого установленного бита или npos.
+  size_type find_first() const { return findFrom(0); }
+
+  /// Индекс первого установленного бита после pos или npos.
+  size_type find_next(size_type pos) const {
+    return pos + 1 >= size_ ? npos : findFrom(pos + 1);
+  }
+
+  /**
+   * @brief Побитовые операции с вектором той же длины.
+   *
+   * @throw std::invalid_argument Если длины различаются.
+   */
+  bitset_vector &operator&=(const bitset_vector &other) {
+    return combine(other, std::bit_and<>(), "&=");
+  }
+
+  bitset_vector &operator|=(const bitset_vector &other) {
+    return combine(other, std::bit_or<>(), "|=");
+  }
+
+  bitset_vector &operator^=(const bitset_vector &other) {
+    return combine(other, std::bit_xor<>(), "^=");
+  }
+
+  bitset_vector operator~() const {
+    bitset_vector result(*this);
+    result.flip();
+    return result;
+  }
+
+  friend bitset_vector operator&(bitset_vector a, const bitset_vector &b) {
+    return a &= b;
+  }
+  friend bitset_vector operator|(bitset_vector a, const bitset_vector &b) {
+    return a |= b;
+  }
+  friend bitset_vector operator^(bitset_vector a, const bitset_vector &b) {
+    return a ^= b;
+  }
+
+  bool operator==(const bitset_vector &other) const {
+    return size_ == other.size_ &&
+           std::equal(words_.data(), words_.data() + words_.size(),
+                      other.words_.data());
+  }
+  bool operator!=(const bitset_vector &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  s21::vector<word_type> words_;
+  size_type size_ = 0;
+
+  static size_type wordsFor(size_type bits) {
+    return (bits + bits_per_word - 1) / bits_per_word;
+  }
+
+  static word_type maskOf(size_type pos) {
+    return word_type{1} << (pos % bits_per_word);
+  }
+
+  /// Обнуляет биты последнего слова за пределами size_.
+  void clearTail() {
+    if (size_ % bits_per_word != 0) {
+      words_[words_.size() - 1] &=
+          ~(~word_type{0} << (size_ % bits_per_word));
+    }
+  }
+
+  void checkIndex(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("bitset_vector::at: index " +
+                              std::to_string(pos) + " >= size " +
+                              std::to_string(size_));
+    }
+  }
+
+  size_type findFrom(size_type pos) const {
+    size_type index = pos / bits_per_word;
+    if (index >= words_.size()) return npos;
+    // Биты до pos в первом слове отбрасываются маской
+    word_type word = words_[index] & (~word_type{0} << (pos % bits_per_word));
+    while (word == 0) {
+      if (++index == words_.size()) return npos;
+      word = words_[index];
+    }
+    return index * bits_per_word +
+           static_cast<size_type>(__builtin_ctzll(word));
+  }
+
+  template <typename Op>
+  bitset_vector &combine(const bitset_vector &other, Op op, const char *name) {
+    if (size_ != other.size_) {
+      throw std::invalid_argument(std::string("bitset_vector::operator") +
+                                  name + ": sizes differ (" +
+                                  std::to_string(size_) + " vs " +
+                                  std::to_string(other.size_) + ")");
+    }
+    simd::transform(words_.data(), words_.data() + words_.size(),
+                    other.words_.data(), words_.data(), op);
+    return *this;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_BITSET_VECTOR_S21_BITSET_VECTOR_H_
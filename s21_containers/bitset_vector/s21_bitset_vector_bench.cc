@@ -0,0 +1,110 @@
+// Бенчмарк битовых карт: s21::bitset_vector против s21::vector<bool>
+// (байт на элемент) и std::vector<bool>. Печатается занятая память и время
+// в миллисекундах для подсчета битов, пересечения двух карт и обхода
+// установленных битов (около 1% от всех).
+//
+// Запуск: ./bench.out [количество битов]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "s21_bitset_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename F>
+double Ms(F f) {
+  auto start = Clock::now();
+  std::size_t result = f();
+  double ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  if (result == 42) std::printf("\n");  // не дает выбросить замер
+  return ms;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 26;
+
+  std::mt19937 rng(1);
+  s21::bitset_vector packed_a(size), packed_b(size);
+  s21::vector<bool> bytes_a(size), bytes_b(size);
+  std::vector<bool> std_a(size), std_b(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    bool a = rng() % 100 == 0;
+    bool b = rng() % 2 == 0;
+    packed_a[i] = a;
+    packed_b[i] = b;
+    bytes_a[i] = a;
+    bytes_b[i] = b;
+    std_a[i] = a;
+    std_b[i] = b;
+  }
+
+  std::printf("%zu bits, memory in MiB, time in ms\n", size);
+  std::printf("  %-14s %20s %20s %20s\n", "", "s21::bitset_vector",
+              "s21::vector<bool>", "std::vector<bool>");
+  std::printf("  %-14s %20.1f %20.1f %20.1f\n", "memory",
+              static_cast<double>(packed_a.word_count() * 8) / (1 << 20),
+              static_cast<double>(bytes_a.size()) / (1 << 20),
+              static_cast<double>(size / 8) / (1 << 20));
+
+  std::printf("  %-14s %20.2f %20.2f %20.2f\n", "count",
+              Ms([&] { return packed_a.count(); }), Ms([&] {
+                return static_cast<std::size_t>(
+                    std::count(bytes_a.begin(), bytes_a.end(), true));
+              }),
+              Ms([&] {
+                return static_cast<std::size_t>(
+                    std::count(std_a.begin(), std_a.end(), true));
+              }));
+
+  std::printf("  %-14s %20.2f %20.2f %20.2f\n", "a &= b", Ms([&] {
+                packed_a &= packed_b;
+                return packed_a.word_count();
+              }),
+              Ms([&] {
+                for (std::size_t i = 0; i < size; ++i) {
+                  bytes_a[i] = bytes_a[i] && bytes_b[i];
+                }
+                return bytes_a.size();
+              }),
+              Ms([&] {
+                for (std::size_t i = 0; i < size; ++i) {
+                  std_a[i] = std_a[i] && std_b[i];
+                }
+                return std_a.size();
+              }));
+
+  std::printf("  %-14s %20.2f %20.2f %20.2f\n", "visit set bits", Ms([&] {
+                std::size_t sum = 0;
+                for (std::size_t i = packed_a.find_first();
+                     i != s21::bitset_vector::npos; i = packed_a.find_next(i)) {
+                  sum += i;
+                }
+                return sum;
+              }),
+              Ms([&] {
+                std::size_t sum = 0;
+                for (std::size_t i = 0; i < size; ++i) {
+                  if (bytes_a[i]) sum += i;
+                }
+                return sum;
+              }),
+              Ms([&] {
+                std::size_t sum = 0;
+                for (std::size_t i = 0; i < size; ++i) {
+                  if (std_a[i]) sum += i;
+                }
+                return sum;
+              }));
+  return 0;
+}
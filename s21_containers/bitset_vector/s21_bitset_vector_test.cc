@@ -0,0 +1,88 @@
+#include "s21_bitset_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../simd/cpufeatures.h"
+
+TEST(bitset_vector, bit_access_and_proxy) {
+  s21::bitset_vector bits{true, false, true};
+  EXPECT_EQ(bits.size(), 3U);
+  EXPECT_TRUE(bits[0]);
+  EXPECT_FALSE(bits[1]);
+  bits[1] = true;
+  bits[2] = bits[0] && false;
+  EXPECT_TRUE(bits.test(1));
+  EXPECT_FALSE(bits.test(2));
+  bits.at(2).flip();
+  EXPECT_TRUE(bits.back());
+  EXPECT_THROW(bits.at(3), std::out_of_range);
+
+  for (int i = 0; i < 200; ++i) bits.push_back(i % 3 == 0);
+  EXPECT_EQ(bits.word_count(), 4U);
+  EXPECT_EQ(std::count(bits.cbegin(), bits.cend(), true), 3 + 67);
+  EXPECT_TRUE(bits.cend() > bits.cbegin());
+  EXPECT_TRUE(bits.cbegin() <= bits.cbegin());
+  EXPECT_TRUE(bits.end() >= bits.begin() + 203);
+  for (auto bit : bits) bit = false;
+  EXPECT_TRUE(bits.none());
+  std::fill(bits.begin(), bits.end(), true);
+  EXPECT_TRUE(bits.all());
+
+  bits.resize(70);
+  bits.resize(130, true);
+  bits.resize(140);
+  EXPECT_EQ(bits.count(), 130U);
+  while (bits.size() > 64) bits.pop_back();
+  EXPECT_EQ(bits.word_count(), 1U);
+  EXPECT_EQ(bits.count(), 64U);
+}
+
+TEST(bitset_vector, matches_std_vector_bool) {
+  std::mt19937 rng(7);
+  const std::size_t kBits = 1000;
+  std::vector<bool> a_ref(kBits), b_ref(kBits);
+  s21::bitset_vector a(kBits), b(kBits);
+  for (std::size_t i = 0; i < kBits; ++i) {
+    a_ref[i] = rng() % 5 == 0;
+    b_ref[i] = rng() % 2 == 0;
+    a[i] = a_ref[i];
+    b[i] = b_ref[i];
+  }
+
+  for (bool avx2 : {false, true}) {
+    bool saved = s21::simd::cpu_features().avx2;
+    s21::simd::cpu_features().avx2 = avx2 && saved;
+    s21::bitset_vector and_bits = a & b;
+    s21::bitset_vector or_bits = a | b;
+    s21::bitset_vector xor_bits = a ^ b;
+    s21::simd::cpu_features().avx2 = saved;
+    for (std::size_t i = 0; i < kBits; ++i) {
+      ASSERT_EQ(and_bits[i], a_ref[i] && b_ref[i]);
+      ASSERT_EQ(or_bits[i], a_ref[i] || b_ref[i]);
+      ASSERT_EQ(xor_bits[i], a_ref[i] != b_ref[i]);
+    }
+  }
+  EXPECT_EQ(a.count(),
+            static_cast<std::size_t>(std::count(a_ref.begin(), a_ref.end(),
+                                                true)));
+  EXPECT_EQ((~a).count(), kBits - a.count());
+
+  // find_first/find_next обходят ровно установленные биты
+  std::vector<std::size_t> expected;
+  for (std::size_t i = 0; i < kBits; ++i) {
+    if (a_ref[i]) expected.push_back(i);
+  }
+  std::vector<std::size_t> found;
+  for (std::size_t i = a.find_first(); i != s21::bitset_vector::npos;
+       i = a.find_next(i)) {
+    found.push_back(i);
+  }
+  EXPECT_EQ(found, expected);
+  EXPECT_EQ(s21::bitset_vector(100).find_first(), s21::bitset_vector::npos);
+  EXPECT_THROW(a &= s21::bitset_vector(10), std::invalid_argument);
+}
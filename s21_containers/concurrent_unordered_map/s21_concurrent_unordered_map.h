@@ -0,0 +1,246 @@
+/**
+ * @file s21_concurrent_unordered_map.h
+ * @brief Потокобезопасный ассоциативный массив с разбиением на шарды.
+ *
+ * Класс concurrent_unordered_map распределяет ключи по N независимым
+ * шардам (lock striping). Каждый шард - это s21::unordered_map под
+ * собственным std::shared_mutex, поэтому потоки, работающие с разными
+ * шардами, не мешают друг другу, а чтения одного шарда идут параллельно.
+ * Шард выбирается по старшим битам перемешанного хеша, а таблица внутри
+ * шарда использует младшие, так что ключи шарда не скапливаются в одной
+ * части его таблицы.
+ *
+ * Итераторов нет: ссылка на элемент не пережила бы снятие блокировки.
+ * Поиск возвращает копию значения, а изменение на месте выполняется
+ * функтором под блокировкой шарда (update, upsert).
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_CONCURRENT_UNORDERED_MAP_S21_CONCURRENT_UNORDERED_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_CONCURRENT_UNORDERED_MAP_S21_CONCURRENT_UNORDERED_MAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "../hashtable/hashmix.h"
+#include "../unordered_map/s21_unordered_map.h"
+
+namespace s21 {
+
+/**
+ * @class concurrent_unordered_map
+ * @brief Хеш-таблица для одновременной работы нескольких потоков.
+ *
+ * Все методы потокобезопасны. Операции над одним ключом атомарны; size() и
+ * for_each() обходят шарды по очереди и при параллельных изменениях видят
+ * согласованное состояние каждого шарда, но не всей таблицы сразу.
+ *
+ * @tparam Key Тип ключа.
+ * @tparam Value Тип значения.
+ * @tparam Hash Хеш-функция для ключей.
+ * @tparam KeyEqual Предикат равенства ключей.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class concurrent_unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  /// Число шардов по умолчанию.
+  static constexpr size_type kDefaultShardCount = 64;
+  /// Размер строки кэша, по которому выравниваются шарды.
+  static constexpr size_type kCacheLineSize = 64;
+
+  /**
+   * @brief Создает таблицу из shards шардов (округляется вверх до степени
+   * двойки).
+   */
+  explicit concurrent_unordered_map(size_type shards = kDefaultShardCount,
+                                    const Hash &hash = Hash(),
+                                    const KeyEqual &equal = KeyEqual())
+      : hash_(hash) {
+    while (shard_count() < shards) {
+      ++shard_bits_;
+    }
+    shards_ = std::make_unique<Shard[]>(shard_count());
+    for (size_type i = 0; i < shard_count(); ++i) {
+      shards_[i].map = Map(0, hash, equal);
+    }
+  }
+
+  concurrent_unordered_map(const concurrent_unordered_map &) = delete;
+  concurrent_unordered_map &operator=(const concurrent_unordered_map &) =
+      delete;
+
+  size_type shard_count() const { return size_type{1} << shard_bits_; }
+
+  /**
+   * @brief Вставляет пару, если ключа еще нет.
+   *
+   * @return true, если элемент был вставлен.
+   */
+  bool insert(const Key &key, const Value &obj) {
+    Shard &shard = shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.insert(key, obj).second;
+  }
+
+  /**
+   * @brief Вставляет пару или заменяет значение существующего ключа.
+   *
+   * @return true, если ключа не было и элемент был вставлен.
+   */
+  bool insert_or_assign(const Key &key, const Value &obj) {
+    Shard &shard = shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.insert_or_assign(key, obj).second;
+  }
+
+  /**
+   * @brief Возвращает копию значения по ключу.
+   *
+   * @return Значение или std::nullopt, если ключа нет.
+   */
+  std::optional<Value> find(const Key &key) const {
+    const Shard &shard = shardFor(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  bool contains(const Key &key) const {
+    const Shard &shard = shardFor(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.contains(key);
+  }
+
+  /**
+   * @brief Удаляет элемент с указанным ключом.
+   *
+   * @return Количество удаленных элементов (0 или 1).
+   */
+  size_type erase(const Key &key) {
+    Shard &shard = shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.erase(key);
+  }
+
+  /**
+   * @brief Атомарно изменяет значение существующего ключа.
+   *
+   * Функтор fn(Value&) вызывается под блокировкой шарда, поэтому не должен
+   * обращаться к этой же таблице.
+   *
+   * @return false, если ключа нет (fn не вызывается).
+   */
+  template <typename Fn>
+  bool update(const Key &key, Fn &&fn) {
+    Shard &shard = shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) {
+      return false;
+    }
+    std::forward<Fn>(fn)(it->second);
+    return true;
+  }
+
+  /**
+   * @brief Атомарно изменяет значение ключа, предварительно вставив
+   * Value(), если ключа нет.
+   *
+   * @return true, если ключ был вставлен.
+   */
+  template <typename Fn>
+  bool upsert(const Key &key, Fn &&fn) {
+    Shard &shard = shardFor(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto result = shard.map.insert(key, Value());
+    std::forward<Fn>(fn)(result.first->second);
+    return result.second;
+  }
+
+  /**
+   * @brief Вызывает fn(const Key&, const Value&) для каждого элемента.
+   *
+   * Шарды обходятся по очереди под разделяемой блокировкой.
+   */
+  template <typename Fn>
+  void for_each(Fn fn) const {
+    for (size_type i = 0; i < shard_count(); ++i) {
+      std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+      for (const auto &item : shards_[i].map) {
+        fn(item.first, item.second);
+      }
+    }
+  }
+
+  size_type size() const {
+    size_type total = 0;
+    for (size_type i = 0; i < shard_count(); ++i) {
+      std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+      total += shards_[i].map.size();
+    }
+    return total;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  void clear() {
+    for (size_type i = 0; i < shard_count(); ++i) {
+      std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+      shards_[i].map.clear();
+    }
+  }
+
+  /// Готовит шарды к хранению count элементов в сумме.
+  void reserve(size_type count) {
+    size_type per_shard = (count + shard_count() - 1) / shard_count();
+    for (size_type i = 0; i < shard_count(); ++i) {
+      std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+      shards_[i].map.reserve(per_shard);
+    }
+  }
+
+ private:
+  using Map = unordered_map<Key, Value, Hash, KeyEqual>;
+
+  // Шард занимает отдельные строки кэша, чтобы захват мьютекса одного шарда
+  // не инвалидировал строку с мьютексом соседнего
+  struct alignas(kCacheLineSize) Shard {
+    mutable std::shared_mutex mutex;
+    Map map;
+  };
+
+  std::unique_ptr<Shard[]> shards_;
+  unsigned shard_bits_ = 0;
+  Hash hash_;
+
+  size_type shardIndex(const Key &key) const {
+    if (shard_bits_ == 0) return 0;
+    return hash_mix(hash_(key)) >> (sizeof(std::size_t) * 8 - shard_bits_);
+  }
+
+  Shard &shardFor(const Key &key) { return shards_[shardIndex(key)]; }
+  const Shard &shardFor(const Key &key) const {
+    return shards_[shardIndex(key)];
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_CONCURRENT_UNORDERED_MAP_S21_CONCURRENT_UNORDERED_MAP_H_
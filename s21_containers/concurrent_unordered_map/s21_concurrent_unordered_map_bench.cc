@@ -0,0 +1,100 @@
+// Бенчмарк масштабирования по потокам: s21::concurrent_unordered_map против
+// s21::map под одним std::mutex. Каждый поток выполняет смесь из 80% поисков
+// и 20% атомарных обновлений счетчиков по случайным ключам.
+//
+// Запуск: ./bench.out [операций на поток] [количество ключей]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "s21_concurrent_unordered_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Прежняя схема: одно дерево под общим мьютексом
+class LockedMap {
+ public:
+  bool Find(long key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void Add(long key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++map_[key];
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<long, long> map_;
+};
+
+class ShardedMap {
+ public:
+  bool Find(long key) { return map_.contains(key); }
+  void Add(long key) {
+    map_.upsert(key, [](long &value) { ++value; });
+  }
+
+ private:
+  s21::concurrent_unordered_map<long, long> map_;
+};
+
+template <typename Map>
+double Run(unsigned threads, std::size_t ops, std::size_t keys) {
+  Map map;
+  for (std::size_t key = 0; key < keys; key += 2) {
+    map.Add(static_cast<long>(key));
+  }
+  std::vector<std::thread> workers;
+  auto start = Clock::now();
+  for (unsigned t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, ops, keys, t] {
+      std::mt19937_64 rng(t + 1);
+      std::size_t found = 0;
+      for (std::size_t i = 0; i < ops; ++i) {
+        long key = static_cast<long>(rng() % keys);
+        if (i % 5 == 0) {
+          map.Add(key);
+        } else {
+          found += map.Find(key);
+        }
+      }
+      if (found == ops) std::printf(" ");  // не дает выбросить цикл
+    });
+  }
+  for (auto &worker : workers) worker.join();
+  double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  return static_cast<double>(ops * threads) / seconds / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t ops = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+  std::size_t keys = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1 << 16;
+  unsigned cores = std::thread::hardware_concurrency();
+  if (cores == 0) cores = 1;
+
+  std::printf("%zu ops/thread over %zu keys, million ops/s, %u cores\n", ops,
+              keys, cores);
+  std::printf("  %8s %16s %16s\n", "threads", "mutex+s21::map",
+              "concurrent_map");
+  // 1, 2, 4, ... и в конце ровно все ядра
+  for (unsigned threads = 1;; threads = std::min(threads * 2, cores)) {
+    double locked = Run<LockedMap>(threads, ops, keys);
+    double sharded = Run<ShardedMap>(threads, ops, keys);
+    std::printf("  %8u %16.2f %16.2f\n", threads, locked, sharded);
+    if (threads == cores) break;
+  }
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../s21_containers.h"
+
+TEST(ConcurrentUnorderedMapTest, SingleThreadOperations) {
+  s21::concurrent_unordered_map<std::string, int> my_map(5);
+  EXPECT_EQ(my_map.shard_count(), 8U);
+  EXPECT_TRUE(my_map.empty());
+  EXPECT_TRUE(my_map.insert("one", 1));
+  EXPECT_FALSE(my_map.insert("one", 10));
+  EXPECT_EQ(my_map.find("one").value(), 1);
+  EXPECT_FALSE(my_map.insert_or_assign("one", 10));
+  EXPECT_TRUE(my_map.insert_or_assign("two", 2));
+  EXPECT_EQ(my_map.find("one").value(), 10);
+  EXPECT_FALSE(my_map.find("three").has_value());
+
+  EXPECT_TRUE(my_map.update("two", [](int &value) { value *= 21; }));
+  EXPECT_FALSE(my_map.update("three", [](int &value) { value = 3; }));
+  EXPECT_EQ(my_map.find("two").value(), 42);
+  EXPECT_TRUE(my_map.upsert("three", [](int &value) { value += 3; }));
+  EXPECT_FALSE(my_map.upsert("three", [](int &value) { value += 3; }));
+  EXPECT_EQ(my_map.find("three").value(), 6);
+
+  EXPECT_EQ(my_map.size(), 3U);
+  EXPECT_EQ(my_map.erase("one"), 1U);
+  EXPECT_EQ(my_map.erase("one"), 0U);
+  EXPECT_FALSE(my_map.contains("one"));
+  int sum = 0;
+  my_map.for_each([&sum](const std::string &, int value) { sum += value; });
+  EXPECT_EQ(sum, 48);
+  my_map.clear();
+  EXPECT_TRUE(my_map.empty());
+}
+
+TEST(ConcurrentUnorderedMapTest, ParallelUpsertsAreAtomic) {
+  s21::concurrent_unordered_map<int, long> counters;
+  counters.reserve(1000);
+  const int kThreads = 4;
+  const int kRounds = 20000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&counters, t] {
+      for (int i = 0; i < kRounds; ++i) {
+        counters.upsert((i * 7 + t) % 1000, [](long &value) { ++value; });
+        if (i % 5 == 0) {
+          counters.find(i % 1000);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  long total = 0;
+  counters.for_each([&total](int, long value) { total += value; });
+  EXPECT_EQ(total, static_cast<long>(kThreads) * kRounds);
+  EXPECT_EQ(counters.size(), 1000U);
+}
+
+TEST(ConcurrentUnorderedMapTest, ParallelInsertAndErase) {
+  s21::concurrent_unordered_map<int, int> my_map(16);
+  std::vector<std::thread> threads;
+  // Каждый поток работает со своим диапазоном ключей
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&my_map, t] {
+      for (int i = t * 10000; i < (t + 1) * 10000; ++i) {
+        my_map.insert_or_assign(i, i);
+      }
+      for (int i = t * 10000; i < (t + 1) * 10000; i += 2) {
+        my_map.erase(i);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(my_map.size(), 20000U);
+  for (int i = 0; i < 40000; ++i) {
+    ASSERT_EQ(my_map.contains(i), i % 2 == 1);
+  }
+}
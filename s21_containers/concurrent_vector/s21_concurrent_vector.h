@@ -0,0 +1,306 @@
+/**
+ * @file s21_concurrent_vector.h
+ * @brief Потокобезопасный вектор только на добавление, без блокировок.
+ *
+ * Класс concurrent_vector хранит элементы в сегментах размером B, 2B, 4B,
+ * ... (как s21::segmented_vector), указатели на которые лежат в таблице
+ * атомарных указателей фиксированного размера. push_back занимает индекс
+ * одним fetch_add, поэтому добавление не ждет других потоков. Следующий
+ * сегмент выделяет заранее поток, занявший середину текущего, так что к
+ * его заполнению он обычно уже опубликован. Если же сегмента еще нет,
+ * его выделяет каждый дошедший до него поток и публикует одним
+ * compare_exchange, проигравшие освобождают свою копию. Элементы никогда
+ * не переносятся.
+ *
+ * Индекс занимается раньше, чем создается элемент, поэтому у каждого слота
+ * есть флаг готовности: элемент опубликован, когда is_published() вернул
+ * true, или когда индекс получен от вызвавшего push_back потока через
+ * синхронизацию (join, мьютекс, атомарную переменную).
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @class concurrent_vector
+ * @brief Вектор с параллельным добавлением и чтением элементов.
+ *
+ * push_back, emplace_back, reserve, size, is_published, at и operator[]
+ * можно вызывать одновременно из разных потоков; operator[] - только для
+ * опубликованных элементов. clear() и деструктор требуют, чтобы других
+ * обращений к вектору не было. Ссылки на элементы действительны до clear().
+ *
+ * Если конструктор элемента или выделение следующего сегмента бросили
+ * исключение, индекс остается занятым, но элемент так и не публикуется.
+ *
+ * Худший случай - поток, занявший середину сегмента, вытеснен до того, как
+ * выделил следующий: тогда каждый из P писателей, дошедших до этого
+ * сегмента, выделяет и размечает свою копию, и в пике занято P копий.
+ * Так же публикуется первый сегмент, у которого нет предыдущего.
+ *
+ * @tparam T Тип элементов.
+ * @tparam Allocator Аллокатор для сегментов.
+ * @tparam FirstSegment Размер первого сегмента, степень двойки.
+ */
+template <typename T, typename Allocator = std::allocator<T>,
+          std::size_t FirstSegment = 64>
+class concurrent_vector {
+  static_assert(FirstSegment > 0 &&
+                    (FirstSegment & (FirstSegment - 1)) == 0,
+                "concurrent_vector: FirstSegment must be a power of two");
+
+  // Ячейка под один элемент. Сегмент из n элементов - это массив ячеек:
+  // сначала n флагов готовности, затем n элементов. Инициализируются только
+  // флаги, так что страницы под элементы не трогаются до первой записи.
+  using Cell = std::aligned_storage_t<sizeof(T), alignof(T)>;
+  using Flag = std::atomic<bool>;
+  using CellAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+  using CellTraits = std::allocator_traits<CellAllocator>;
+  using ValueAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+  using ValueTraits = std::allocator_traits<ValueAllocator>;
+
+  // Флаг и место элемента внутри сегмента
+  struct Slot {
+    Flag *ready;
+    Cell *cell;
+
+    T *place() const { return reinterpret_cast<T *>(cell); }
+    T *value() const { return std::launder(reinterpret_cast<T *>(cell)); }
+  };
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  /// Размер первого сегмента.
+  static constexpr size_type first_segment_size = FirstSegment;
+
+  concurrent_vector() = default;
+
+  explicit concurrent_vector(const allocator_type &alloc)
+      : cell_alloc_(alloc), value_alloc_(alloc) {}
+
+  concurrent_vector(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+
+  ~concurrent_vector() {
+    clear();
+    for (size_type segment = 0; segment < kMaxSegments; ++segment) {
+      Cell *cells = segments_[segment].load(std::memory_order_relaxed);
+      if (cells != nullptr) releaseSegment(cells, segment);
+    }
+  }
+
+  /**
+   * @brief Добавляет элемент в конец.
+   *
+   * @return Индекс добавленного элемента.
+   */
+  size_type push_back(const_reference value) { return emplace_back(value); }
+  size_type push_back(value_type &&value) {
+    return emplace_back(std::move(value));
+  }
+
+  /// Создает элемент в конце и возвращает его индекс.
+  template <typename... Args>
+  size_type emplace_back(Args &&...args) {
+    size_type index = size_.fetch_add(1, std::memory_order_relaxed);
+    size_type segment = segmentOf(index);
+    Slot slot = slotIn(segmentAt(segment), index);
+    // Середину сегмента занимает ровно один поток: он и выделяет следующий
+    if (index - segmentStart(segment) == segmentSize(segment) / 2 &&
+        segment + 1 < kMaxSegments) {
+      segmentAt(segment + 1);
+    }
+    ValueTraits::construct(value_alloc_, slot.place(),
+                           std::forward<Args>(args)...);
+    slot.ready->store(true, std::memory_order_release);
+    return index;
+  }
+
+  /// Выделяет сегменты под new_capacity элементов заранее.
+  void reserve(size_type new_capacity) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("concurrent_vector::reserve: capacity " +
+                              std::to_string(new_capacity) +
+                              " exceeds max_size");
+    }
+    if (new_capacity == 0) return;
+    size_type last = segmentOf(new_capacity - 1);
+    for (size_type segment = 0; segment <= last; ++segment) {
+      segmentAt(segment);
+    }
+  }
+
+  /// Количество занятых индексов, включая еще не опубликованные элементы.
+  size_type size() const { return size_.load(std::memory_order_acquire); }
+  bool empty() const { return size() == 0; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / (sizeof(Cell) + 1);
+  }
+  allocator_type get_allocator() const { return allocator_type(value_alloc_); }
+
+  /// Создан ли уже элемент с индексом pos.
+  bool is_published(size_type pos) const {
+    if (pos >= size()) return false;
+    Cell *cells = loadSegment(segmentOf(pos));
+    return cells != nullptr &&
+           slotIn(cells, pos).ready->load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Доступ к опубликованному элементу с проверкой.
+   *
+   * @throw std::out_of_range Если элемента pos нет или он еще создается.
+   */
+  reference at(size_type pos) {
+    checkPublished(pos);
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    checkPublished(pos);
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) {
+    return *slotIn(loadSegment(segmentOf(pos)), pos).value();
+  }
+  const_reference operator[](size_type pos) const {
+    return *slotIn(loadSegment(segmentOf(pos)), pos).value();
+  }
+
+  /**
+   * @brief Разрушает все элементы, сохраняя сегменты.
+   *
+   * Не потокобезопасен: других обращений к вектору быть не должно.
+   */
+  void clear() {
+    size_type count = size_.load(std::memory_order_relaxed);
+    for (size_type index = 0; index < count; ++index) {
+      Cell *cells = loadSegment(segmentOf(index));
+      if (cells == nullptr) continue;
+      Slot slot = slotIn(cells, index);
+      if (slot.ready->load(std::memory_order_relaxed)) {
+        ValueTraits::destroy(value_alloc_, slot.value());
+        slot.ready->store(false, std::memory_order_relaxed);
+      }
+    }
+    size_.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_type kDigits = std::numeric_limits<size_type>::digits;
+  static constexpr size_type kFirstShift = [] {
+    size_type shift = 0;
+    while ((size_type{1} << shift) < FirstSegment) ++shift;
+    return shift;
+  }();
+  static constexpr size_type kMaxSegments = kDigits - kFirstShift;
+
+  // Индекс и таблица сегментов в разных строках кэша: fetch_add пишущих
+  // потоков не вытесняет таблицу у читающих
+  alignas(64) std::atomic<size_type> size_{0};
+  alignas(64) std::atomic<Cell *> segments_[kMaxSegments] = {};
+  CellAllocator cell_alloc_;
+  ValueAllocator value_alloc_;
+
+  static size_type segmentSize(size_type segment) {
+    return FirstSegment << segment;
+  }
+
+  static size_type segmentStart(size_type segment) {
+    return (FirstSegment << segment) - FirstSegment;
+  }
+
+  static size_type segmentOf(size_type index) {
+    size_type j = index + FirstSegment;
+    return kDigits - 1 - static_cast<size_type>(__builtin_clzll(j)) -
+           kFirstShift;
+  }
+
+  /// Число ячеек под флаги сегмента.
+  static size_type flagCells(size_type segment) {
+    return (segmentSize(segment) * sizeof(Flag) + sizeof(Cell) - 1) /
+           sizeof(Cell);
+  }
+
+  static size_type cellCount(size_type segment) {
+    return flagCells(segment) + segmentSize(segment);
+  }
+
+  /// Флаг и место элемента index в сегменте cells.
+  static Slot slotIn(Cell *cells, size_type index) {
+    size_type segment = segmentOf(index);
+    size_type offset = index - segmentStart(segment);
+    return {reinterpret_cast<Flag *>(cells) + offset,
+            cells + flagCells(segment) + offset};
+  }
+
+  /// Сегмент или nullptr, если он еще не опубликован.
+  Cell *loadSegment(size_type segment) const {
+    return segments_[segment].load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Возвращает сегмент, выделяя и публикуя его при необходимости.
+   *
+   * Обычно сегмент уже выделен заранее из emplace_back. Иначе - одна
+   * попытка compare_exchange: при неудаче сегмент уже опубликован другим
+   * потоком, и своя копия освобождается.
+   */
+  Cell *segmentAt(size_type segment) {
+    if (segment >= kMaxSegments) {
+      throw std::length_error("concurrent_vector: too many segments");
+    }
+    Cell *cells = loadSegment(segment);
+    if (cells != nullptr) return cells;
+    Cell *fresh = CellTraits::allocate(cell_alloc_, cellCount(segment));
+    Flag *flags = reinterpret_cast<Flag *>(fresh);
+    for (size_type i = 0; i < segmentSize(segment); ++i) {
+      ::new (static_cast<void *>(flags + i)) Flag(false);
+    }
+    if (segments_[segment].compare_exchange_strong(
+            cells, fresh, std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+      return fresh;
+    }
+    releaseSegment(fresh, segment);
+    return cells;
+  }
+
+  /// Освобождает сегмент; элементов в нем быть не должно.
+  void releaseSegment(Cell *cells, size_type segment) {
+    CellTraits::deallocate(cell_alloc_, cells, cellCount(segment));
+  }
+
+  void checkPublished(size_type pos) const {
+    if (!is_published(pos)) {
+      throw std::out_of_range("concurrent_vector::at: element " +
+                              std::to_string(pos) + " is not published");
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_H_
@@ -0,0 +1,96 @@
+// Бенчмарк добавления из нескольких потоков: s21::concurrent_vector против
+// s21::vector под одним std::mutex. Каждый поток добавляет [событий на
+// поток] событий по 16 байт; печатается пропускная способность в
+// миллионах push_back в секунду. Потоков 1, 2, 4, ... до [потоков].
+//
+// Запуск: ./bench.out [событий на поток] [потоков]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "s21_concurrent_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Event {
+  long timestamp;
+  long payload;
+};
+
+// Прежняя схема: общий вектор под мьютексом
+class LockedLog {
+ public:
+  void Add(const Event &event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.push_back(event);
+  }
+  std::size_t Size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::vector<Event> events_;
+};
+
+class ConcurrentLog {
+ public:
+  void Add(const Event &event) { events_.push_back(event); }
+  std::size_t Size() { return events_.size(); }
+
+ private:
+  s21::concurrent_vector<Event> events_;
+};
+
+template <typename Log>
+double Run(unsigned threads, std::size_t events) {
+  Log log;
+  std::vector<std::thread> producers;
+  auto start = Clock::now();
+  for (unsigned t = 0; t < threads; ++t) {
+    producers.emplace_back([&log, events, t] {
+      for (std::size_t i = 0; i < events; ++i) {
+        log.Add(Event{static_cast<long>(i), static_cast<long>(t)});
+      }
+    });
+  }
+  for (auto &producer : producers) producer.join();
+  double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  if (log.Size() != events * threads) std::printf("size mismatch\n");
+  return static_cast<double>(events * threads) / seconds / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t events =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 21;
+  unsigned cores = std::thread::hardware_concurrency();
+  unsigned max_threads =
+      argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))
+               : std::max(cores, 1U);
+  if (max_threads == 0) max_threads = 1;
+
+  std::printf("%zu events/thread, million push_back/s, %u cores\n", events,
+              cores);
+  std::printf("  %8s %18s %18s\n", "threads", "mutex+s21::vector",
+              "concurrent_vector");
+  // 1, 2, 4, ... и в конце ровно max_threads
+  for (unsigned threads = 1;; threads = std::min(threads * 2, max_threads)) {
+    double locked = Run<LockedLog>(threads, events);
+    double concurrent = Run<ConcurrentLog>(threads, events);
+    std::printf("  %8u %18.2f %18.2f\n", threads, locked, concurrent);
+    if (threads == max_threads) break;
+  }
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include "s21_concurrent_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Неосвобожденные блоки всех CountingAllocator
+std::atomic<int> live_blocks{0};
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(std::size_t n) {
+    ++live_blocks;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) {
+    --live_blocks;
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+
+}  // namespace
+
+TEST(concurrent_vector, push_back_returns_index) {
+  s21::concurrent_vector<std::string, std::allocator<std::string>, 2> vector;
+  EXPECT_TRUE(vector.empty());
+  EXPECT_EQ(vector.push_back("a"), 0U);
+  EXPECT_EQ(vector.emplace_back(3, 'b'), 1U);
+  const std::string *first = &vector[0];
+  for (int i = 0; i < 100; ++i) {
+    vector.push_back(std::to_string(i));
+  }
+  // элементы не переносятся при добавлении сегментов
+  EXPECT_EQ(&vector[0], first);
+  EXPECT_EQ(vector.size(), 102U);
+  EXPECT_EQ(vector[1], "bbb");
+  EXPECT_EQ(vector.at(101), "99");
+  EXPECT_TRUE(vector.is_published(101));
+  EXPECT_FALSE(vector.is_published(102));
+  EXPECT_THROW(vector.at(102), std::out_of_range);
+  vector.clear();
+  EXPECT_TRUE(vector.empty());
+  vector.reserve(1000);
+  EXPECT_EQ(vector.push_back("c"), 0U);
+}
+
+TEST(concurrent_vector, concurrent_producers_and_reader) {
+  const int kThreads = 4;
+  const int kPerThread = 20000;
+  s21::concurrent_vector<long> vector;
+  std::atomic<bool> done{false};
+  long reader_sum = 0;
+
+  // Читатель проверяет все опубликованные на данный момент элементы
+  std::thread reader([&] {
+    while (!done.load()) {
+      std::size_t size = vector.size();
+      for (std::size_t i = 0; i < size; ++i) {
+        if (vector.is_published(i)) reader_sum += vector[i] >= 0 ? 0 : 1;
+      }
+    }
+  });
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreads; ++t) {
+    producers.emplace_back([&vector, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        std::size_t index = vector.push_back(t * kPerThread + i);
+        ASSERT_EQ(vector[index], t * kPerThread + i);
+      }
+    });
+  }
+  for (std::thread &producer : producers) producer.join();
+  done.store(true);
+  reader.join();
+
+  EXPECT_EQ(reader_sum, 0);
+  ASSERT_EQ(vector.size(), static_cast<std::size_t>(kThreads * kPerThread));
+  std::vector<int> seen(kThreads * kPerThread, 0);
+  for (std::size_t i = 0; i < vector.size(); ++i) {
+    ASSERT_TRUE(vector.is_published(i));
+    ++seen[vector[i]];
+  }
+  for (int count : seen) EXPECT_EQ(count, 1);
+}
+
+TEST(concurrent_vector, producers_cross_segment_boundaries) {
+  const int kThreads = 8;
+  const int kPerThread = 50000;
+  // Сегменты 16, 32, ..., 2^18: добавление пересекает 14 границ
+  {
+    s21::concurrent_vector<long, CountingAllocator<long>, 16> vector;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+      producers.emplace_back([&vector, t] {
+        for (int i = 0; i < kPerThread; ++i) {
+          vector.push_back(t * kPerThread + i);
+        }
+      });
+    }
+    for (std::thread &producer : producers) producer.join();
+
+    ASSERT_EQ(vector.size(), static_cast<std::size_t>(kThreads * kPerThread));
+    std::vector<int> seen(kThreads * kPerThread, 0);
+    for (std::size_t i = 0; i < vector.size(); ++i) {
+      ASSERT_TRUE(vector.is_published(i));
+      ++seen[vector[i]];
+    }
+    for (int count : seen) EXPECT_EQ(count, 1);
+    // 15 заполняемых сегментов и шестнадцатый, выделенный заранее, когда
+    // была занята середина пятнадцатого; копии проигравших гонку освобождены
+    EXPECT_EQ(live_blocks, 16);
+  }
+  EXPECT_EQ(live_blocks, 0);
+}
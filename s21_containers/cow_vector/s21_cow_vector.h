@@ -0,0 +1,370 @@
+/**
+ * @file s21_cow_vector.h
+ * @brief Вектор с копированием при записи (copy-on-write).
+ *
+ * Копии cow_vector разделяют один буфер со счетчиком ссылок: копирование и
+ * передача по значению стоят одного атомарного инкремента. Буфер
+ * клонируется при первом изменяющем обращении к вектору, у которого есть
+ * другие владельцы. Счетчик атомарный, поэтому копии можно отдавать в
+ * другие потоки и читать или изменять там независимо.
+ *
+ * Неконстантные at(), operator[], front(), back(), data() и итераторы
+ * считаются изменяющими: они отделяют буфер и помечают вектор как
+ * «выдавший ссылки». Копия такого вектора сразу получает собственный
+ * буфер, иначе запись по выданной ранее ссылке была бы видна и в копии.
+ * Для чтения без отделения есть константные методы и cbegin()/cend().
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_COW_VECTOR_S21_COW_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_COW_VECTOR_S21_COW_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/**
+ * @class cow_vector
+ * @brief Динамический массив с разделяемым буфером.
+ *
+ * Один объект cow_vector, как и s21::vector, нельзя одновременно изменять
+ * из нескольких потоков; разные копии - можно.
+ *
+ * @tparam T Тип элементов.
+ * @tparam Allocator Аллокатор элементов.
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class cow_vector {
+  using Items = s21::vector<T, Allocator>;
+
+  // Буфер вместе со счетчиком владельцев
+  struct Shared {
+    std::atomic<std::size_t> refs{1};
+    Items items;
+
+    explicit Shared(Items &&values) : items(std::move(values)) {}
+  };
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using SharedAllocator =
+      typename AllocTraits::template rebind_alloc<Shared>;
+  using SharedTraits = std::allocator_traits<SharedAllocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  cow_vector() = default;
+
+  explicit cow_vector(const allocator_type &alloc) : alloc_(alloc) {}
+
+  explicit cow_vector(size_type n,
+                      const allocator_type &alloc = allocator_type())
+      : alloc_(alloc) {
+    if (n > 0) shared_ = makeShared(Items(n, alloc_));
+  }
+
+  explicit cow_vector(std::initializer_list<value_type> const &items,
+                      const allocator_type &alloc = allocator_type())
+      : alloc_(alloc) {
+    if (items.size() > 0) shared_ = makeShared(Items(items, alloc_));
+  }
+
+  /// Забирает элементы s21::vector вместе с его аллокатором без копирования.
+  explicit cow_vector(Items &&items) : alloc_(items.get_allocator()) {
+    if (!items.empty()) shared_ = makeShared(std::move(items));
+  }
+
+  /// Разделяет буфер other; если other выдавал ссылки - копирует его.
+  cow_vector(const cow_vector &other)
+      : alloc_(AllocTraits::select_on_container_copy_construction(
+            other.alloc_)),
+        shared_(shareFrom(other)) {}
+
+  cow_vector(cow_vector &&other) noexcept
+      : alloc_(std::move(other.alloc_)),
+        shared_(std::exchange(other.shared_, nullptr)),
+        leaked_(std::exchange(other.leaked_, false)) {}
+
+  cow_vector &operator=(const cow_vector &other) {
+    if (this != &other) {
+      if constexpr (AllocTraits::propagate_on_container_copy_assignment::
+                        value) {
+        // Буфер возвращается аллокатору, который его выделил
+        if (alloc_ != other.alloc_) release();
+        alloc_ = other.alloc_;
+      }
+      Shared *shared = shareFrom(other);
+      release();
+      shared_ = shared;
+      leaked_ = false;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Забирает буфер other. Если аллокатор не переносится при
+   * перемещении и аллокаторы не равны, буфер other остается у него, а
+   * элементы переносятся в свой буфер.
+   */
+  cow_vector &operator=(cow_vector &&other) noexcept(
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value) {
+    if (this == &other) return *this;
+    release();
+    leaked_ = false;
+    if constexpr (!AllocTraits::propagate_on_container_move_assignment::
+                      value) {
+      if (alloc_ != other.alloc_) {
+        if (other.is_shared()) {
+          shared_ = clone(other.shared_->items, 0);
+        } else if (other.shared_ != nullptr) {
+          // other - единственный владелец: элементы перемещаются
+          Items items(alloc_);
+          items = std::move(other.shared_->items);
+          shared_ = makeShared(std::move(items));
+        }
+        other.release();
+        other.leaked_ = false;
+        return *this;
+      }
+    }
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(other.alloc_);
+    }
+    shared_ = std::exchange(other.shared_, nullptr);
+    leaked_ = std::exchange(other.leaked_, false);
+    return *this;
+  }
+
+  ~cow_vector() { release(); }
+
+  /// Количество векторов, разделяющих буфер (0 у пустого без буфера).
+  size_type use_count() const {
+    return shared_ ? shared_->refs.load(std::memory_order_acquire) : 0;
+  }
+
+  /// Разделяет ли вектор буфер с другими.
+  bool is_shared() const { return use_count() > 1; }
+
+  allocator_type get_allocator() const { return alloc_; }
+
+  // Чтение без отделения буфера
+
+  const_reference at(size_type pos) const {
+    checkIndex(pos);
+    return cdata()[pos];
+  }
+
+  const_reference operator[](size_type pos) const { return cdata()[pos]; }
+  const_reference front() const { return cdata()[0]; }
+  const_reference back() const { return cdata()[size() - 1]; }
+  const value_type *data() const { return cdata(); }
+  const_iterator begin() const { return cdata(); }
+  const_iterator end() const { return cdata() + size(); }
+  const_iterator cbegin() const { return cdata(); }
+  const_iterator cend() const { return cdata() + size(); }
+
+  bool empty() const { return size() == 0; }
+  size_type size() const { return shared_ ? shared_->items.size() : 0; }
+  size_type capacity() const {
+    return shared_ ? shared_->items.capacity() : 0;
+  }
+
+  /// Константный доступ ко всему содержимому как к s21::vector.
+  const Items &items() const { return shared_ ? shared_->items : empty_; }
+
+  // Доступ на запись: буфер отделяется, вектор помечается выдавшим ссылки
+
+  reference at(size_type pos) {
+    checkIndex(pos);
+    return leak()[pos];
+  }
+
+  reference operator[](size_type pos) { return leak()[pos]; }
+  reference front() { return leak()[0]; }
+  reference back() { return leak()[size() - 1]; }
+  value_type *data() { return leak().data(); }
+  iterator begin() { return leak().data(); }
+  iterator end() { return leak().data() + size(); }
+
+  // Изменения: буфер отделяется, если у него есть другие владельцы
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity()) mutate(new_capacity).reserve(new_capacity);
+  }
+
+  void shrink_to_fit() {
+    if (shared_ != nullptr && size() < capacity()) {
+      mutate().shrink_to_fit();
+    }
+  }
+
+  void clear() {
+    if (is_shared()) {
+      release();
+      leaked_ = false;
+    } else if (shared_ != nullptr) {
+      shared_->items.clear();
+    }
+  }
+
+  void resize(size_type n) { mutate(n).resize(n); }
+  void resize(size_type n, const_reference value) {
+    value_type copy(value);
+    mutate(n).resize(n, copy);
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    // Аргументы могут ссылаться на общий буфер, который после отделения
+    // держат только другие владельцы: значение создается до отделения
+    if (is_shared()) {
+      value_type value(std::forward<Args>(args)...);
+      return mutate(size() + 1).emplace_back(std::move(value));
+    }
+    return mutate(size() + 1).emplace_back(std::forward<Args>(args)...);
+  }
+
+  void pop_back() { mutate().pop_back(); }
+
+  /**
+   * @brief Вставляет value перед позицией index.
+   *
+   * Позиция задается индексом: итератор из общего буфера после отделения
+   * указывал бы в чужую память.
+   */
+  void insert(size_type index, const_reference value) {
+    value_type copy(value);
+    Items &items = mutate(size() + 1);
+    items.insert(items.cbegin() + index, std::move(copy));
+  }
+
+  /// Удаляет элемент с индексом index.
+  void erase(size_type index) {
+    Items &items = mutate();
+    items.erase(items.begin() + index);
+  }
+
+  /// Как и у std::vector, аллокаторы без propagate_on_container_swap
+  /// должны быть равны.
+  void swap(cow_vector &other) noexcept {
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+    std::swap(shared_, other.shared_);
+    std::swap(leaked_, other.leaked_);
+  }
+
+  bool operator==(const cow_vector &other) const {
+    return shared_ == other.shared_ ||
+           std::equal(cbegin(), cend(), other.cbegin(), other.cend());
+  }
+  bool operator!=(const cow_vector &other) const { return !(*this == other); }
+
+ private:
+  allocator_type alloc_;
+  Shared *shared_ = nullptr;
+  // Выданы ли ссылки на элементы: копии такого вектора не разделяют буфер
+  bool leaked_ = false;
+
+  inline static const Items empty_{};
+
+  Shared *makeShared(Items &&items) {
+    SharedAllocator alloc(alloc_);
+    Shared *shared = SharedTraits::allocate(alloc, 1);
+    try {
+      SharedTraits::construct(alloc, shared, std::move(items));
+    } catch (...) {
+      SharedTraits::deallocate(alloc, shared, 1);
+      throw;
+    }
+    return shared;
+  }
+
+  Shared *clone(const Items &items, size_type min_capacity) {
+    Items copy(alloc_);
+    copy.reserve(std::max(items.size(), min_capacity));
+    copy.insert(copy.cend(), items.data(), items.data() + items.size());
+    return makeShared(std::move(copy));
+  }
+
+  const value_type *cdata() const {
+    return shared_ ? shared_->items.data() : nullptr;
+  }
+
+  /**
+   * @brief Буфер для копии other: общий или собственный, если other выдавал
+   * ссылки или его аллокатор не равен своему.
+   */
+  Shared *shareFrom(const cow_vector &other) {
+    if (other.shared_ == nullptr) return nullptr;
+    if (other.leaked_ || alloc_ != other.alloc_) {
+      return clone(other.shared_->items, 0);
+    }
+    other.shared_->refs.fetch_add(1, std::memory_order_relaxed);
+    return other.shared_;
+  }
+
+  void release() {
+    if (shared_ != nullptr &&
+        shared_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      SharedAllocator alloc(alloc_);
+      SharedTraits::destroy(alloc, shared_);
+      SharedTraits::deallocate(alloc, shared_, 1);
+    }
+    shared_ = nullptr;
+  }
+
+  void checkIndex(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("cow_vector::at: index " + std::to_string(pos) +
+                              " >= size " + std::to_string(size()));
+    }
+  }
+
+  /**
+   * @brief Делает буфер единоличным и возвращает его элементы.
+   *
+   * Клон сразу получает емкость min_capacity, чтобы следующая операция
+   * (например, push_back) не переносила его еще раз.
+   */
+  Items &mutate(size_type min_capacity = 0) {
+    if (shared_ == nullptr) {
+      shared_ = makeShared(Items(alloc_));
+    } else if (shared_->refs.load(std::memory_order_acquire) > 1) {
+      Shared *own = clone(shared_->items, min_capacity);
+      release();
+      shared_ = own;
+    }
+    return shared_->items;
+  }
+
+  Items &leak() {
+    Items &items = mutate();
+    leaked_ = true;
+    return items;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_COW_VECTOR_S21_COW_VECTOR_H_
@@ -0,0 +1,82 @@
+// Бенчмарк конвейера, стадии которого получают вектор по значению и в
+// основном только читают его: s21::vector против s21::cow_vector. Каждая
+// стадия суммирует окно из 4096 элементов, каждая [период записи]-я
+// добавляет элемент и передает измененную копию дальше (0 - без записи).
+// Печатается время всего конвейера в миллисекундах.
+//
+// Запуск: ./bench.out [элементов] [стадий] [период записи]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+
+#include "../vector/s21_vector.h"
+#include "s21_cow_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::size_t kWindow = 4096;
+
+// Стадия читает окно из kWindow элементов, зависящее от номера стадии
+long Sum(const s21::vector<int> &v, std::size_t stage) {
+  const int *first = v.data() + stage * kWindow % (v.size() - kWindow + 1);
+  return std::accumulate(first, first + kWindow, 0L);
+}
+
+long Sum(const s21::cow_vector<int> &v, std::size_t stage) {
+  const int *first = v.cbegin() + stage * kWindow % (v.size() - kWindow + 1);
+  return std::accumulate(first, first + kWindow, 0L);
+}
+
+// Стадия конвейера: вектор приходит копией, как в исходном коде
+template <typename Vector>
+Vector Stage(Vector input, std::size_t stage, std::size_t write_period,
+             long &checksum) {
+  checksum += Sum(input, stage);
+  if (write_period != 0 && stage % write_period == write_period - 1) {
+    input.push_back(static_cast<int>(stage));
+  }
+  return input;
+}
+
+template <typename Vector>
+double Run(const Vector &source, std::size_t stages,
+           std::size_t write_period, long &checksum) {
+  auto start = Clock::now();
+  Vector current = source;
+  for (std::size_t stage = 0; stage < stages; ++stage) {
+    // current передается копией и остается у вызывающего, как если бы
+    // стадии жили в разных потоках
+    current = Stage(current, stage, write_period, checksum);
+  }
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+  if (size < kWindow) size = kWindow;
+  std::size_t stages = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+  std::size_t period = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 10;
+
+  s21::vector<int> plain;
+  for (std::size_t i = 0; i < size; ++i) plain.push_back(static_cast<int>(i));
+  s21::cow_vector<int> shared{s21::vector<int>(plain)};
+
+  long plain_sum = 0;
+  long cow_sum = 0;
+  double plain_ms = Run(plain, stages, period, plain_sum);
+  double cow_ms = Run(shared, stages, period, cow_sum);
+  if (plain_sum != cow_sum) std::printf("checksum mismatch\n");
+
+  std::printf("%zu ints, %zu stages, write every %zu stages, ms\n", size,
+              stages, period);
+  std::printf("  %-16s %10.1f\n", "s21::vector", plain_ms);
+  std::printf("  %-16s %10.1f\n", "s21::cow_vector", cow_ms);
+  return 0;
+}
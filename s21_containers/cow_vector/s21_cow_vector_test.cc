@@ -0,0 +1,116 @@
+#include "s21_cow_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../test_support/tracking_resource.h"
+
+using s21::test_support::TrackingResource;
+
+TEST(cow_vector, copies_share_until_write) {
+  s21::cow_vector<std::string> original{"a", "b", "c"};
+  s21::cow_vector<std::string> copy = original;
+  EXPECT_EQ(copy.cbegin(), original.cbegin());
+  EXPECT_EQ(original.use_count(), 2U);
+
+  // константное чтение не отделяет буфер
+  const auto &view = copy;
+  EXPECT_EQ(view[1], "b");
+  EXPECT_EQ(view.at(2), "c");
+  EXPECT_TRUE(copy.is_shared());
+
+  copy.push_back(copy.cbegin()[0]);
+  EXPECT_FALSE(copy.is_shared());
+  EXPECT_NE(copy.cbegin(), original.cbegin());
+  EXPECT_GE(copy.capacity(), 4U);
+  EXPECT_EQ(original.size(), 3U);
+  EXPECT_EQ(copy.size(), 4U);
+  EXPECT_EQ(copy.back(), "a");
+
+  s21::cow_vector<std::string> third = original;
+  third.erase(0);
+  third.insert(1, "x");
+  EXPECT_EQ(third, (s21::cow_vector<std::string>{"b", "x", "c"}));
+  EXPECT_EQ(original, (s21::cow_vector<std::string>{"a", "b", "c"}));
+  third.clear();
+  EXPECT_TRUE(third.empty());
+  EXPECT_THROW(view.at(4), std::out_of_range);
+}
+
+TEST(cow_vector, leaked_reference_is_not_shared) {
+  s21::cow_vector<int> vector{1, 2, 3};
+  int &first = vector[0];
+  s21::cow_vector<int> copy = vector;
+  // копия вектора, выдавшего ссылку, получает свой буфер
+  EXPECT_FALSE(copy.is_shared());
+  first = 10;
+  EXPECT_EQ(copy.cbegin()[0], 1);
+  EXPECT_EQ(vector.cbegin()[0], 10);
+
+  s21::cow_vector<int> again = copy;
+  EXPECT_TRUE(again.is_shared());
+  again = std::move(vector);
+  EXPECT_EQ(again.front(), 10);
+  EXPECT_EQ(copy.use_count(), 1U);
+}
+
+TEST(cow_vector, copies_in_threads) {
+  s21::vector<long> values;
+  for (long i = 0; i < 1000; ++i) values.push_back(i);
+  const s21::cow_vector<long> source(std::move(values));
+
+  std::vector<std::thread> threads;
+  std::vector<long> sums(4);
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&source, &sums, t] {
+      for (int round = 0; round < 200; ++round) {
+        s21::cow_vector<long> copy = source;
+        if (round % 10 == t) copy.push_back(1);
+        sums[t] += std::accumulate(copy.cbegin(), copy.cend(), 0L);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  EXPECT_EQ(source.use_count(), 1U);
+  for (long sum : sums) EXPECT_EQ(sum, 200L * 999 * 1000 / 2 + 20);
+}
+
+TEST(cow_vector, polymorphic_allocator) {
+  using Allocator = std::pmr::polymorphic_allocator<int>;
+  using Vector = s21::cow_vector<int, Allocator>;
+  TrackingResource first, second;
+  {
+    Vector vector{Allocator(&first)};
+    vector.push_back(1);
+    vector.push_back(2);
+    EXPECT_EQ(vector.get_allocator().resource(), &first);
+    EXPECT_FALSE(first.live.empty());
+
+    // копия получает аллокатор по умолчанию и свой буфер
+    Vector copy = vector;
+    EXPECT_EQ(copy.get_allocator().resource(),
+              std::pmr::get_default_resource());
+    EXPECT_FALSE(copy.is_shared());
+    EXPECT_EQ(copy, vector);
+
+    Vector same{Allocator(&first)};
+    same = vector;
+    EXPECT_EQ(vector.use_count(), 2U);
+
+    Vector other(3, Allocator(&second));
+    other = std::move(vector);
+    EXPECT_EQ(other.get_allocator().resource(), &second);
+    EXPECT_EQ(other.cbegin()[1], 2);
+    EXPECT_EQ(same.use_count(), 1U);
+    EXPECT_TRUE(vector.empty());
+  }
+  EXPECT_EQ(first.foreign, 0);
+  EXPECT_EQ(second.foreign, 0);
+  EXPECT_TRUE(first.live.empty());
+  EXPECT_TRUE(second.live.empty());
+}
@@ -0,0 +1,29 @@
+/**
+ * @file s21_flat_hash_map.h
+ * @brief Ассоциативный массив на хеш-таблице с групповым пробированием.
+ *
+ * Контейнер flat_hash_map хранит пары "ключ-значение" в таблице GroupTable:
+ * поиск сравнивает фрагменты хеша целой группы слотов одной векторной
+ * инструкцией, поэтому особенно быстро отвечает на запросы отсутствующих
+ * ключей. Интерфейс совпадает с s21::unordered_map; в отличие от него,
+ * удаление не перемещает остальные элементы.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_FLAT_HASH_MAP_S21_FLAT_HASH_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_FLAT_HASH_MAP_S21_FLAT_HASH_MAP_H_
+
+#include <functional>
+
+#include "../hashtable/grouptable.h"
+#include "../hashtable/hashmap.h"
+
+namespace s21 {
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using flat_hash_map = HashMap<Key, Value, Hash, KeyEqual, GroupTable>;
+
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_FLAT_HASH_MAP_S21_FLAT_HASH_MAP_H_
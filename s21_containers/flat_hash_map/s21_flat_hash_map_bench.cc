@@ -0,0 +1,76 @@
+// Бенчмарк s21::flat_hash_map против s21::unordered_map и
+// std::unordered_map на целочисленных ключах: вставка, успешный и неуспешный
+// поиск. Для flat_hash_map поиск замеряется с AVX2 (если доступен) и с
+// принудительным SSE2.
+//
+// Запуск: ./bench.out [количество элементов]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../unordered_map/s21_unordered_map.h"
+#include "s21_flat_hash_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+template <typename Map>
+void Run(const char *name, const std::vector<long> &keys,
+         const std::vector<long> &missing) {
+  Map map;
+  auto start = Clock::now();
+  for (long key : keys) {
+    map.insert({key, key});
+  }
+  double insert = Seconds(start);
+
+  std::size_t found = 0;
+  start = Clock::now();
+  for (long key : keys) {
+    found += map.find(key) != map.end();
+  }
+  double hit = Seconds(start);
+  start = Clock::now();
+  for (long key : missing) {
+    found += map.find(key) != map.end();
+  }
+  double miss = Seconds(start);
+
+  double n = static_cast<double>(keys.size());
+  std::printf("  %-24s %10.2f %10.2f %10.2f   (found %zu)\n", name,
+              n / insert / 1e6, n / hit / 1e6, n / miss / 1e6, found);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+
+  std::mt19937_64 rng(42);
+  std::vector<long> keys(size), missing(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    keys[i] = static_cast<long>(rng() >> 1) | 1;  // нечетные присутствуют
+    missing[i] = static_cast<long>(rng() >> 1) & ~1L;  // четные отсутствуют
+  }
+
+  std::printf("%zu random long keys, million ops/s (avx2: %s)\n", size,
+              s21::simd::has_avx2() ? "yes" : "no");
+  std::printf("  %-24s %10s %10s %10s\n", "container", "insert", "hit",
+              "miss");
+  Run<std::unordered_map<long, long>>("std::unordered_map", keys, missing);
+  Run<s21::unordered_map<long, long>>("s21::unordered_map", keys, missing);
+  Run<s21::flat_hash_map<long, long>>("s21::flat_hash_map", keys, missing);
+  s21::simd::cpu_features().avx2 = false;
+  Run<s21::flat_hash_map<long, long>>("s21::flat_hash_map sse2", keys,
+                                      missing);
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+
+#include "../../s21_containers.h"
+
+TEST(FlatHashMapTest, InsertionAndAccess) {
+  s21::flat_hash_map<std::string, int> my_map = {{"one", 1}, {"two", 2}};
+  EXPECT_EQ(my_map.size(), 2U);
+  EXPECT_EQ(my_map.at("two"), 2);
+  EXPECT_THROW(my_map.at("three"), std::out_of_range);
+  my_map["three"] = 3;
+  EXPECT_EQ(my_map["three"], 3);
+  EXPECT_FALSE(my_map.insert("one", 10).second);
+  EXPECT_EQ(my_map["one"], 1);
+  EXPECT_FALSE(my_map.insert_or_assign("one", 10).second);
+  EXPECT_EQ(my_map["one"], 10);
+  EXPECT_TRUE(my_map.contains("three"));
+  EXPECT_TRUE(my_map.find("four") == my_map.end());
+}
+
+TEST(FlatHashMapTest, EraseKeepsOtherIterators) {
+  s21::flat_hash_map<int, int> my_map;
+  for (int i = 0; i < 200; ++i) my_map[i] = i * i;
+  auto kept = my_map.find(150);
+  for (int i = 0; i < 200; i += 2) my_map.erase(my_map.find(i));
+  // Удаление без сдвига: итератор на оставшийся элемент действителен
+  EXPECT_EQ(kept->first, 150);
+  EXPECT_EQ(my_map.size(), 100U);
+  std::map<int, int> collected(my_map.begin(), my_map.end());
+  EXPECT_EQ(collected.size(), 100U);
+  EXPECT_EQ(collected.begin()->first, 1);
+  EXPECT_EQ(collected.rbegin()->second, 199 * 199);
+}
+
+TEST(FlatHashMapTest, MatchesStdWithAndWithoutAvx2) {
+  bool saved = s21::simd::cpu_features().avx2;
+  for (bool avx2 : {saved, false}) {
+    s21::simd::cpu_features().avx2 = avx2;
+    s21::flat_hash_map<int, int> my_map;
+    std::map<int, int> reference;
+    std::mt19937 rng(3);
+    for (int step = 0; step < 10000; ++step) {
+      int key = static_cast<int>(rng() % 1500);
+      if (rng() % 4 == 0) {
+        ASSERT_EQ(my_map.erase(key), reference.erase(key));
+      } else {
+        my_map[key] = step;
+        reference[key] = step;
+      }
+    }
+    ASSERT_EQ(my_map.size(), reference.size());
+    for (int key = 0; key < 1500; ++key) {
+      auto it = reference.find(key);
+      ASSERT_EQ(my_map.contains(key), it != reference.end());
+      if (it != reference.end()) {
+        ASSERT_EQ(my_map.at(key), it->second);
+      }
+    }
+  }
+  s21::simd::cpu_features().avx2 = saved;
+}
+
+TEST(FlatHashMapTest, BucketInterface) {
+  s21::flat_hash_map<int, int> my_map;
+  my_map.reserve(1000);
+  std::size_t buckets = my_map.bucket_count();
+  EXPECT_GE(buckets, 1000U);
+  auto results = my_map.insert_many(std::make_pair(1, 1),
+                                    std::make_pair(2, 2),
+                                    std::make_pair(1, 3));
+  EXPECT_TRUE(results[1].second);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ(results[2].first->second, 1);
+  EXPECT_EQ(my_map.bucket_count(), buckets);
+  EXPECT_LE(my_map.load_factor(), my_map.max_load_factor());
+}
+
+TEST(FlatHashSetTest, InsertEraseMerge) {
+  s21::flat_hash_set<int> my_set = {4, 2, 3, 1, 2};
+  EXPECT_EQ(my_set.size(), 4U);
+  std::set<int> collected(my_set.begin(), my_set.end());
+  EXPECT_EQ(collected, (std::set<int>{1, 2, 3, 4}));
+  EXPECT_FALSE(my_set.insert(3).second);
+  my_set.erase(my_set.find(3));
+  EXPECT_FALSE(my_set.contains(3));
+
+  s21::flat_hash_set<int> other = {3, 4, 5};
+  my_set.merge(other);
+  EXPECT_EQ(my_set.size(), 5U);
+  EXPECT_TRUE(other.empty());
+}
@@ -0,0 +1,27 @@
+/**
+ * @file s21_flat_hash_set.h
+ * @brief Множество на хеш-таблице с групповым пробированием.
+ *
+ * Контейнер flat_hash_set хранит уникальные ключи в таблице GroupTable.
+ * Интерфейс совпадает с s21::unordered_set.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_FLAT_HASH_SET_S21_FLAT_HASH_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_FLAT_HASH_SET_S21_FLAT_HASH_SET_H_
+
+#include <functional>
+
+#include "../hashtable/grouptable.h"
+#include "../hashtable/hashset.h"
+
+namespace s21 {
+
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using flat_hash_set = HashSet<Key, Hash, KeyEqual, GroupTable>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_FLAT_HASH_SET_S21_FLAT_HASH_SET_H_
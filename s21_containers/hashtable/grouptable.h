@@ -0,0 +1,654 @@
+/**
+ * @file grouptable.h
+ * @brief Хеш-таблица с групповым пробированием по байтам метаданных.
+ *
+ * Данный файл содержит класс GroupTable, на котором построены контейнеры
+ * flat_hash_map и flat_hash_set. Слоты разбиты на группы по 15 штук, для
+ * каждой группы хранится 16 управляющих байтов: 15 байтов с фрагментом хеша
+ * (тегом) занятых слотов и байт переполнения. Шаг поиска сравнивает все теги
+ * группы одной SSE2-инструкцией, а цепочки переполнения при наличии AVX2
+ * (определяется во время выполнения) проходятся по две группы за шаг.
+ *
+ * Байт переполнения хранит 8 битов, индексируемых хешем: бит выставляется,
+ * когда вставка проходит мимо заполненной группы. Поиск останавливается на
+ * первой группе без нужного бита, поэтому пустые слоты не обязаны прерывать
+ * цепочку и удаление просто очищает тег, без надгробий. Устаревшие биты
+ * переполнения копятся при удалениях; когда из-за них кончается запас
+ * вставок, а элементов не больше половины допустимого, таблица
+ * перехешируется на месте без выделения памяти.
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_GROUPTABLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_GROUPTABLE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../simd/cpufeatures.h"
+#include "hashmix.h"
+
+namespace s21 {
+
+/**
+ * @class GroupTable
+ * @brief Хеш-таблица с открытой адресацией и SIMD-пробированием групп.
+ *
+ * Число групп всегда степень двойки, группы пробируются линейно. После
+ * последней группы хранится копия управляющих байтов группы 0, чтобы AVX2
+ * мог прочитать две соседние группы одним невыровненным чтением.
+ *
+ * @tparam Key Тип ключа.
+ * @tparam Value Тип хранимого элемента (ключ или пара ключ-значение).
+ * @tparam KeyOf Функтор, извлекающий ключ из элемента.
+ * @tparam Hash Хеш-функция для ключей.
+ * @tparam KeyEqual Предикат равенства ключей.
+ */
+template <typename Key, typename Value, typename KeyOf,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class GroupTable {
+ public:
+  using size_type = std::size_t;
+
+  /// Количество управляющих байтов в группе.
+  static constexpr size_type kGroupWidth = 16;
+  /// Количество слотов в группе (последний байт - биты переполнения).
+  static constexpr size_type kGroupSlots = 15;
+  /// Коэффициент заполнения по умолчанию.
+  static constexpr float kDefaultMaxLoadFactor = 0.875f;
+  /// Признак отсутствия элемента в результатах поиска по индексу.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  /**
+   * @brief Итератор по занятым слотам таблицы.
+   *
+   * @tparam Const Если true, итератор дает только чтение элементов.
+   */
+  template <bool Const>
+  class IteratorBase {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = Value;
+    using pointer = std::conditional_t<Const, const Value*, Value*>;
+    using reference = std::conditional_t<Const, const Value&, Value&>;
+    using iterator_category = std::forward_iterator_tag;
+    using TablePtr =
+        std::conditional_t<Const, const GroupTable*, GroupTable*>;
+
+    IteratorBase() : table_(nullptr), index_(0) {}
+    IteratorBase(TablePtr table, size_type index)
+        : table_(table), index_(index) {}
+    // Неконстантный итератор неявно приводится к константному
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorBase(const IteratorBase<OtherConst>& other)
+        : table_(other.table()), index_(other.index()) {}
+
+    reference operator*() const { return table_->slots_[index_]; }
+    pointer operator->() const { return &table_->slots_[index_]; }
+
+    IteratorBase& operator++() {
+      index_ = table_->nextOccupied(index_ + 1);
+      return *this;
+    }
+    IteratorBase operator++(int) {
+      IteratorBase tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const IteratorBase& other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const IteratorBase& other) const {
+      return !(*this == other);
+    }
+
+    TablePtr table() const { return table_; }
+    size_type index() const { return index_; }
+
+   private:
+    TablePtr table_;
+    size_type index_;
+  };
+
+  using Iterator = IteratorBase<false>;
+  using ConstIterator = IteratorBase<true>;
+
+  /**
+   * @brief Создает таблицу, способную принять bucket_count слотов без
+   * перехеширования (или пустую таблицу без памяти при нуле).
+   */
+  explicit GroupTable(size_type bucket_count = 0, const Hash& hash = Hash(),
+                      const KeyEqual& equal = KeyEqual())
+      : hash_(hash), equal_(equal) {
+    if (bucket_count > 0) {
+      rehash(bucket_count);
+    }
+  }
+
+  GroupTable(const GroupTable& other)
+      : hash_(other.hash_),
+        equal_(other.equal_),
+        max_load_factor_(other.max_load_factor_) {
+    allocate(other.groups_);
+    if (groups_ == 0) return;
+    // Копируем слоты по тем же индексам вместе с битами переполнения
+    std::memcpy(ctrl_, other.ctrl_, ctrlBytes(groups_));
+    for (size_type i = 0; i < capacity(); ++i) {
+      if (isFull(ctrlAt(i))) {
+        new (slots_ + i) Value(other.slots_[i]);
+      }
+    }
+    size_ = other.size_;
+    growth_left_ = other.growth_left_;
+  }
+
+  GroupTable(GroupTable&& other) noexcept
+      : hash_(std::move(other.hash_)),
+        equal_(std::move(other.equal_)),
+        max_load_factor_(other.max_load_factor_) {
+    steal(other);
+  }
+
+  GroupTable& operator=(const GroupTable& other) {
+    if (this != &other) {
+      GroupTable tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  GroupTable& operator=(GroupTable&& other) noexcept {
+    if (this != &other) {
+      release();
+      hash_ = std::move(other.hash_);
+      equal_ = std::move(other.equal_);
+      max_load_factor_ = other.max_load_factor_;
+      steal(other);
+    }
+    return *this;
+  }
+
+  ~GroupTable() { release(); }
+
+  Iterator begin() { return Iterator(this, nextOccupied(0)); }
+  Iterator end() { return Iterator(this, capacity()); }
+  ConstIterator cbegin() const { return ConstIterator(this, nextOccupied(0)); }
+  ConstIterator cend() const { return ConstIterator(this, capacity()); }
+
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_type bucket_count() const { return capacity(); }
+
+  float load_factor() const {
+    return groups_ == 0 ? 0.0f
+                        : static_cast<float>(size_) /
+                              static_cast<float>(capacity());
+  }
+  float max_load_factor() const { return max_load_factor_; }
+
+  /**
+   * @brief Задает максимальный коэффициент заполнения.
+   *
+   * Значение ограничивается диапазоном [0.1, 0.95]. Если текущее заполнение
+   * превышает новое значение, таблица увеличивается.
+   */
+  void max_load_factor(float ml) {
+    max_load_factor_ = std::min(std::max(ml, 0.1f), 0.95f);
+    if (size_ > maxLoadFor(groups_)) {
+      rehash(0);
+    } else {
+      growth_left_ = maxLoadFor(groups_) - size_;
+    }
+  }
+
+  /**
+   * @brief Перестраивает таблицу с числом слотов не меньше count.
+   *
+   * Если подходящее число групп совпадает с текущим, таблица
+   * перехешируется на месте: элементы возвращаются ближе к своим группам, а
+   * устаревшие биты переполнения сбрасываются.
+   */
+  void rehash(size_type count) {
+    size_type groups = 1;
+    while (groups * kGroupSlots < count || maxLoadFor(groups) < size_) {
+      groups *= 2;
+    }
+    if (groups == groups_) {
+      rehashInPlace();
+    } else {
+      resize(groups);
+    }
+  }
+
+  /// Готовит таблицу к хранению count элементов без перехеширования.
+  void reserve(size_type count) {
+    size_type needed = static_cast<size_type>(
+        std::ceil(static_cast<float>(count) / max_load_factor_));
+    if (needed > capacity()) {
+      rehash(needed);
+    }
+  }
+
+  /// Удаляет все элементы, сохраняя выделенную память.
+  void clear() {
+    for (size_type i = 0; i < capacity(); ++i) {
+      if (isFull(ctrlAt(i))) {
+        slots_[i].~Value();
+      }
+    }
+    if (groups_ != 0) {
+      std::memset(ctrl_, kEmpty, ctrlBytes(groups_));
+    }
+    size_ = 0;
+    growth_left_ = maxLoadFor(groups_);
+  }
+
+  void swap(GroupTable& other) noexcept {
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+    std::swap(slots_, other.slots_);
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(groups_, other.groups_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+  }
+
+  Iterator find(const Key& key) {
+    size_type index = findIndex(key);
+    return index == npos ? end() : Iterator(this, index);
+  }
+
+  ConstIterator find(const Key& key) const {
+    size_type index = findIndex(key);
+    return index == npos ? cend() : ConstIterator(this, index);
+  }
+
+  bool contains(const Key& key) const { return findIndex(key) != npos; }
+
+  /**
+   * @brief Вставляет элемент, если его ключа еще нет в таблице.
+   *
+   * @return Пара из итератора на элемент с этим ключом и признака вставки.
+   */
+  template <typename V>
+  std::pair<Iterator, bool> insert(V&& value) {
+    std::size_t h = hash_mix(hash_(KeyOf()(value)));
+    size_type index = findIndex(KeyOf()(value), h);
+    if (index != npos) {
+      return {Iterator(this, index), false};
+    }
+    // Ключа нет, значит value не ссылается на элемент таблицы и переживет
+    // перестройку
+    if (growth_left_ == 0) {
+      growForInsert();
+    }
+    index = findEmptySlot(h);
+    new (slots_ + index) Value(std::forward<V>(value));
+    setCtrl(index, tagOf(h));
+    ++size_;
+    --growth_left_;
+    return {Iterator(this, index), true};
+  }
+
+  /**
+   * @brief Удаляет элемент с указанным ключом.
+   *
+   * @return Количество удаленных элементов (0 или 1).
+   */
+  size_type erase(const Key& key) {
+    size_type index = findIndex(key);
+    if (index == npos) return 0;
+    eraseIndex(index);
+    return 1;
+  }
+
+  /**
+   * @brief Удаляет элемент, на который указывает итератор.
+   *
+   * Остальные элементы не перемещаются, итераторы на них остаются
+   * действительными.
+   */
+  void erase(ConstIterator pos) {
+    if (pos.index() < capacity() && isFull(ctrlAt(pos.index()))) {
+      eraseIndex(pos.index());
+    }
+  }
+
+ private:
+  static constexpr std::uint8_t kEmpty = 0;
+  // Элемент ожидает нового места во время перехеширования на месте
+  static constexpr std::uint8_t kPending = 1;
+  static constexpr unsigned kSlotsMask = (1u << kGroupSlots) - 1;
+
+  Value* slots_ = nullptr;
+  std::uint8_t* ctrl_ = nullptr;
+  size_type groups_ = 0;
+  size_type size_ = 0;
+  size_type growth_left_ = 0;
+  Hash hash_;
+  KeyEqual equal_;
+  float max_load_factor_ = kDefaultMaxLoadFactor;
+
+  static bool isFull(std::uint8_t ctrl) { return ctrl > kPending; }
+
+  // Тег - младший байт хеша, значения 0 и 1 зарезервированы
+  static std::uint8_t tagOf(std::size_t h) {
+    std::uint8_t tag = static_cast<std::uint8_t>(h);
+    return tag > kPending ? tag : static_cast<std::uint8_t>(tag + 2);
+  }
+  static std::uint8_t overflowBitOf(std::size_t h) {
+    return static_cast<std::uint8_t>(1u << ((h >> 8) & 7));
+  }
+  size_type homeGroup(std::size_t h) const { return (h >> 16) & (groups_ - 1); }
+
+  size_type capacity() const { return groups_ * kGroupSlots; }
+  static size_type ctrlBytes(size_type groups) {
+    return (groups + 1) * kGroupWidth;
+  }
+  size_type maxLoadFor(size_type groups) const {
+    return static_cast<size_type>(
+        static_cast<float>(groups * kGroupSlots) * max_load_factor_);
+  }
+
+  const std::uint8_t* group(size_type g) const {
+    return ctrl_ + g * kGroupWidth;
+  }
+  std::uint8_t ctrlAt(size_type slot) const {
+    return ctrl_[slot / kGroupSlots * kGroupWidth + slot % kGroupSlots];
+  }
+
+  // Запись управляющего байта с обновлением копии группы 0
+  void setCtrl(size_type slot, std::uint8_t value) {
+    size_type g = slot / kGroupSlots;
+    size_type i = slot % kGroupSlots;
+    ctrl_[g * kGroupWidth + i] = value;
+    if (g == 0) {
+      ctrl_[groups_ * kGroupWidth + i] = value;
+    }
+  }
+
+  void setOverflow(size_type g, std::uint8_t bit) {
+    ctrl_[g * kGroupWidth + kGroupSlots] |= bit;
+    if (g == 0) {
+      ctrl_[groups_ * kGroupWidth + kGroupSlots] |= bit;
+    }
+  }
+
+  static unsigned lowestBit(unsigned mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+    unsigned bit = 0;
+    while (!(mask & 1u)) {
+      mask >>= 1;
+      ++bit;
+    }
+    return bit;
+#endif
+  }
+
+  /// Маска слотов группы, управляющий байт которых равен value.
+  static unsigned matchMask(const std::uint8_t* ctrl, std::uint8_t value) {
+#if S21_SIMD_X86
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+    return static_cast<unsigned>(
+               _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, pattern))) &
+           kSlotsMask;
+#else
+    unsigned mask = 0;
+    for (size_type i = 0; i < kGroupSlots; ++i) {
+      if (ctrl[i] == value) mask |= 1u << i;
+    }
+    return mask;
+#endif
+  }
+
+  /// Маска свободных или ожидающих перемещения слотов группы.
+  static unsigned availableMask(const std::uint8_t* ctrl) {
+    unsigned mask = 0;
+    for (size_type i = 0; i < kGroupSlots; ++i) {
+      if (!isFull(ctrl[i])) mask |= 1u << i;
+    }
+    return mask;
+  }
+
+  size_type nextOccupied(size_type slot) const {
+    while (slot < capacity() && !isFull(ctrlAt(slot))) {
+      ++slot;
+    }
+    return slot;
+  }
+
+  size_type findIndex(const Key& key) const {
+    if (size_ == 0) return npos;
+    return findIndex(key, hash_mix(hash_(key)));
+  }
+
+  size_type findIndex(const Key& key, std::size_t h) const {
+    if (size_ == 0) return npos;
+    const std::uint8_t tag = tagOf(h);
+    const std::uint8_t bit = overflowBitOf(h);
+    size_type g = homeGroup(h);
+    for (size_type probes = 0; probes < groups_; ++probes) {
+      const std::uint8_t* ctrl = group(g);
+      for (unsigned m = matchMask(ctrl, tag); m != 0; m &= m - 1) {
+        size_type slot = g * kGroupSlots + lowestBit(m);
+        if (equal_(KeyOf()(slots_[slot]), key)) return slot;
+      }
+      if (!(ctrl[kGroupSlots] & bit)) return npos;
+      g = (g + 1) & (groups_ - 1);
+#if S21_SIMD_AVX2
+      // Почти все поиски завершаются в своей группе; длинные цепочки
+      // переполнения дальше проходятся по две группы за шаг
+      if (probes == 0 && simd::has_avx2()) {
+        return findOverflowAvx2(key, tag, bit, g, groups_ - 1);
+      }
+#endif
+    }
+    return npos;
+  }
+
+#if S21_SIMD_AVX2
+  /**
+   * @brief Продолжает поиск с группы g, сравнивая теги двух соседних групп
+   * за одну AVX2-операцию.
+   *
+   * Чтение 32 байтов с группы g захватывает и группу g + 1: для последней
+   * группы это копия группы 0, хранящаяся в конце массива.
+   */
+  S21_TARGET_AVX2 size_type findOverflowAvx2(const Key& key, std::uint8_t tag,
+                                             std::uint8_t bit, size_type g,
+                                             size_type groups) const {
+    const __m256i pattern = _mm256_set1_epi8(static_cast<char>(tag));
+    const size_type mask = groups_ - 1;
+    for (size_type probes = 0; probes < groups; probes += 2) {
+      const std::uint8_t* ctrl = group(g);
+      __m256i bytes =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctrl));
+      unsigned m = static_cast<unsigned>(
+          _mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, pattern)));
+      for (unsigned lo = m & kSlotsMask; lo != 0; lo &= lo - 1) {
+        size_type slot = g * kGroupSlots + lowestBit(lo);
+        if (equal_(KeyOf()(slots_[slot]), key)) return slot;
+      }
+      if (!(ctrl[kGroupSlots] & bit)) return npos;
+      size_type next = (g + 1) & mask;
+      for (unsigned hi = (m >> kGroupWidth) & kSlotsMask; hi != 0;
+           hi &= hi - 1) {
+        size_type slot = next * kGroupSlots + lowestBit(hi);
+        if (equal_(KeyOf()(slots_[slot]), key)) return slot;
+      }
+      if (!(ctrl[kGroupWidth + kGroupSlots] & bit)) return npos;
+      g = (next + 1) & mask;
+    }
+    return npos;
+  }
+#endif
+
+  /**
+   * @brief Находит первый пустой слот на пути пробирования хеша h.
+   *
+   * Заполненные группы, мимо которых проходит поиск, получают бит
+   * переполнения, чтобы поиск ключа продолжался за ними.
+   */
+  size_type findEmptySlot(std::size_t h) {
+    const std::uint8_t bit = overflowBitOf(h);
+    size_type g = homeGroup(h);
+    for (;;) {
+      unsigned m = matchMask(group(g), kEmpty);
+      if (m != 0) return g * kGroupSlots + lowestBit(m);
+      setOverflow(g, bit);
+      g = (g + 1) & (groups_ - 1);
+    }
+  }
+
+  void eraseIndex(size_type index) {
+    slots_[index].~Value();
+    setCtrl(index, kEmpty);
+    --size_;
+    // Слот в группе без переполнения снова полностью пригоден для вставки;
+    // иначе его бит переполнения остается и запас вставок не возвращается
+    if (group(index / kGroupSlots)[kGroupSlots] == 0) {
+      ++growth_left_;
+    }
+  }
+
+  /**
+   * @brief Освобождает место для вставки, когда запас вставок исчерпан.
+   *
+   * Если элементов не больше половины допустимого, запас съели устаревшие
+   * биты переполнения: таблица перехешируется на месте. Иначе число групп
+   * удваивается.
+   */
+  void growForInsert() {
+    if (groups_ != 0 && size_ <= maxLoadFor(groups_) / 2) {
+      rehashInPlace();
+    } else {
+      resize(groups_ == 0 ? 1 : groups_ * 2);
+    }
+  }
+
+  /**
+   * @brief Перехеширует таблицу без выделения памяти.
+   *
+   * Все элементы помечаются как ожидающие, биты переполнения сбрасываются.
+   * Затем каждый ожидающий элемент получает первый свободный или ожидающий
+   * слот на своем пути пробирования: остается в своей группе, переезжает в
+   * пустой слот или меняется местами с другим ожидающим элементом, который
+   * обрабатывается следующим.
+   */
+  void rehashInPlace() {
+    if (groups_ == 0) return;
+    for (size_type g = 0; g < groups_; ++g) {
+      std::uint8_t* ctrl = ctrl_ + g * kGroupWidth;
+      for (size_type i = 0; i < kGroupSlots; ++i) {
+        if (isFull(ctrl[i])) ctrl[i] = kPending;
+      }
+      ctrl[kGroupSlots] = 0;
+    }
+    std::memcpy(ctrl_ + groups_ * kGroupWidth, ctrl_, kGroupWidth);
+
+    for (size_type slot = 0; slot < capacity(); ++slot) {
+      while (ctrlAt(slot) == kPending) {
+        std::size_t h = hash_mix(hash_(KeyOf()(slots_[slot])));
+        const std::uint8_t bit = overflowBitOf(h);
+        size_type g = homeGroup(h);
+        unsigned m = availableMask(group(g));
+        while (m == 0) {
+          setOverflow(g, bit);
+          g = (g + 1) & (groups_ - 1);
+          m = availableMask(group(g));
+        }
+        if (g == slot / kGroupSlots) {
+          setCtrl(slot, tagOf(h));  // Своя группа: остаемся на месте
+          break;
+        }
+        size_type target = g * kGroupSlots + lowestBit(m);
+        if (ctrlAt(target) == kEmpty) {
+          new (slots_ + target) Value(std::move(slots_[slot]));
+          slots_[slot].~Value();
+          setCtrl(target, tagOf(h));
+          setCtrl(slot, kEmpty);
+        } else {
+          std::swap(slots_[slot], slots_[target]);
+          setCtrl(target, tagOf(h));
+        }
+      }
+    }
+    growth_left_ = maxLoadFor(groups_) - size_;
+  }
+
+  void allocate(size_type groups) {
+    groups_ = groups;
+    slots_ = groups ? std::allocator<Value>().allocate(groups * kGroupSlots)
+                    : nullptr;
+    ctrl_ = groups ? new std::uint8_t[ctrlBytes(groups)]() : nullptr;
+    size_ = 0;
+    growth_left_ = maxLoadFor(groups);
+  }
+
+  void release() {
+    clear();
+    if (slots_ != nullptr) {
+      std::allocator<Value>().deallocate(slots_, capacity());
+    }
+    delete[] ctrl_;
+    slots_ = nullptr;
+    ctrl_ = nullptr;
+    groups_ = size_ = growth_left_ = 0;
+  }
+
+  void resize(size_type groups) {
+    Value* old_slots = slots_;
+    std::uint8_t* old_ctrl = ctrl_;
+    size_type old_groups = groups_;
+    size_type count = size_;
+    allocate(groups);
+    for (size_type g = 0; g < old_groups; ++g) {
+      const std::uint8_t* ctrl = old_ctrl + g * kGroupWidth;
+      for (size_type i = 0; i < kGroupSlots; ++i) {
+        if (!isFull(ctrl[i])) continue;
+        Value& value = old_slots[g * kGroupSlots + i];
+        std::size_t h = hash_mix(hash_(KeyOf()(value)));
+        size_type index = findEmptySlot(h);
+        new (slots_ + index) Value(std::move(value));
+        setCtrl(index, tagOf(h));
+        value.~Value();
+      }
+    }
+    size_ = count;
+    growth_left_ = maxLoadFor(groups_) - size_;
+    if (old_slots != nullptr) {
+      std::allocator<Value>().deallocate(old_slots, old_groups * kGroupSlots);
+    }
+    delete[] old_ctrl;
+  }
+
+  void steal(GroupTable& other) noexcept {
+    slots_ = other.slots_;
+    ctrl_ = other.ctrl_;
+    groups_ = other.groups_;
+    size_ = other.size_;
+    growth_left_ = other.growth_left_;
+    other.slots_ = nullptr;
+    other.ctrl_ = nullptr;
+    other.groups_ = other.size_ = other.growth_left_ = 0;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_GROUPTABLE_H_
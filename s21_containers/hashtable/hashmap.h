@@ -0,0 +1,243 @@
+/**
+ * @file hashmap.h
+ * @brief Общая реализация неупорядоченных ассоциативных массивов.
+ *
+ * Класс HashMap хранит пары "ключ-значение" в хеш-таблице с открытой
+ * адресацией и предоставляет интерфейс s21::map. Конкретная схема таблицы
+ * задается шаблонным параметром, на нем построены unordered_map
+ * (RobinHoodTable) и flat_hash_map (GroupTable).
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHMAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHMAP_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * @brief Извлекает ключ из пары ключ-значение для хеш-таблицы.
+ */
+template <typename Key>
+struct PairKeyOf {
+  template <typename Pair>
+  const Key &operator()(const Pair &pair) const {
+    return pair.first;
+  }
+};
+
+/**
+ * @class HashMap
+ * @brief Ассоциативный массив поверх хеш-таблицы с открытой адресацией.
+ *
+ * Общая реализация unordered_map и flat_hash_map: интерфейс повторяет
+ * s21::map, а размещение элементов определяет таблица TableT.
+ *
+ * @tparam TableT Шаблон таблицы (RobinHoodTable или GroupTable).
+ */
+template <typename Key, typename Value, typename Hash, typename KeyEqual,
+          template <typename, typename, typename, typename, typename>
+          class TableT>
+class HashMap {
+  using KeyValuePair = std::pair<Key, Value>;
+  using Table = TableT<Key, KeyValuePair, PairKeyOf<Key>, Hash, KeyEqual>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  /**
+   * @brief Итератор по элементам хеш-таблицы.
+   *
+   * Как и MapIterator, отдает пару с константным ключом приведением типа
+   * хранимой пары, чтобы ключ нельзя было изменить через итератор.
+   */
+  template <bool Const>
+  class IteratorBase {
+    using TableIterator = typename Table::template IteratorBase<Const>;
+
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = HashMap::value_type;
+    using pointer =
+        std::conditional_t<Const, const value_type *, value_type *>;
+    using reference =
+        std::conditional_t<Const, const value_type &, value_type &>;
+    using iterator_category = std::forward_iterator_tag;
+
+    IteratorBase() = default;
+    explicit IteratorBase(const TableIterator &it) : it_(it) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorBase(const IteratorBase<OtherConst> &other)
+        : it_(other.base()) {}
+
+    reference operator*() const { return *operator->(); }
+    pointer operator->() const { return reinterpret_cast<pointer>(&*it_); }
+
+    IteratorBase &operator++() {
+      ++it_;
+      return *this;
+    }
+    IteratorBase operator++(int) {
+      IteratorBase tmp = *this;
+      ++it_;
+      return tmp;
+    }
+
+    bool operator==(const IteratorBase &other) const {
+      return it_ == other.it_;
+    }
+    bool operator!=(const IteratorBase &other) const {
+      return it_ != other.it_;
+    }
+
+    const TableIterator &base() const { return it_; }
+
+   private:
+    TableIterator it_;
+  };
+
+  using iterator = IteratorBase<false>;
+  using const_iterator = IteratorBase<true>;
+
+  HashMap() = default;
+  explicit HashMap(size_type bucket_count, const Hash &hash = Hash(),
+                   const KeyEqual &equal = KeyEqual())
+      : table_(bucket_count, hash, equal) {}
+  HashMap(std::initializer_list<value_type> const &items) {
+    table_.reserve(items.size());
+    for (const auto &item : items) {
+      insert(item);
+    }
+  }
+  HashMap(const HashMap &m) = default;
+  HashMap(HashMap &&m) noexcept = default;
+  HashMap &operator=(const HashMap &m) = default;
+  HashMap &operator=(HashMap &&m) noexcept = default;
+  ~HashMap() = default;
+
+  mapped_type &at(const Key &key) {
+    auto it = table_.find(key);
+    if (it == table_.end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  const mapped_type &at(const Key &key) const {
+    auto it = table_.find(key);
+    if (it == table_.cend()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  mapped_type &operator[](const key_type &key) {
+    auto it = table_.find(key);
+    if (it != table_.end()) {
+      return it->second;
+    }
+    return table_.insert(KeyValuePair{key, mapped_type()}).first->second;
+  }
+
+  iterator begin() { return iterator(table_.begin()); }
+  iterator end() { return iterator(table_.end()); }
+  const_iterator begin() const { return const_iterator(table_.cbegin()); }
+  const_iterator end() const { return const_iterator(table_.cend()); }
+  const_iterator cbegin() const { return const_iterator(table_.cbegin()); }
+  const_iterator cend() const { return const_iterator(table_.cend()); }
+
+  [[nodiscard]] size_type size() const { return table_.size(); }
+  [[nodiscard]] bool empty() const { return table_.empty(); }
+  [[nodiscard]] size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(KeyValuePair);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    auto result = table_.insert(value);
+    return {iterator(result.first), result.second};
+  }
+
+  std::pair<iterator, bool> insert(const Key &key, const Value &obj) {
+    return insert({key, obj});
+  }
+
+  // Заменяет значение по ключу
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const Value &obj) {
+    auto it = table_.find(key);
+    if (it != table_.end()) {
+      it->second = obj;
+      return {iterator(it), false};
+    }
+    return insert(key, obj);
+  }
+
+  iterator find(const Key &key) { return iterator(table_.find(key)); }
+  const_iterator find(const Key &key) const {
+    return const_iterator(table_.find(key));
+  }
+
+  bool contains(const Key &key) const { return table_.contains(key); }
+
+  void clear() { table_.clear(); }
+
+  void swap(HashMap &other) { table_.swap(other.table_); }
+
+  void erase(iterator pos) {
+    if (pos != end()) {
+      table_.erase(pos.base());
+    }
+  }
+
+  size_type erase(const Key &key) { return table_.erase(key); }
+
+  void merge(HashMap &other) {
+    if (this == &other) return;
+    for (auto it = other.begin(); it != other.end(); ++it) {
+      insert(*it);
+    }
+    other.clear();
+  }
+
+  // Вставка при открытой адресации может переставлять элементы, поэтому
+  // итераторы результата получаются повторным поиском после всех вставок.
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    table_.reserve(size() + sizeof...(args));
+    std::vector<std::pair<iterator, bool>> results = {
+        {end(), insert(args).second}...};
+    std::size_t i = 0;
+    ((results[i++].first = find(PairKeyOf<Key>()(args))), ...);
+    return results;
+  }
+
+  // Управление корзинами и коэффициентом заполнения
+  size_type bucket_count() const { return table_.bucket_count(); }
+  float load_factor() const { return table_.load_factor(); }
+  float max_load_factor() const { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void rehash(size_type count) { table_.rehash(count); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+ private:
+  Table table_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHMAP_H_
@@ -0,0 +1,37 @@
+/**
+ * @file hashmix.h
+ * @brief Перемешивание значения хеш-функции для таблиц с открытой адресацией.
+ *
+ * Таблицы размером в степень двойки берут индекс из младших битов хеша, а
+ * std::hash для целых чисел на большинстве реализаций тождественен. Без
+ * перемешивания последовательные или кратные ключи попадают в одни и те же
+ * корзины.
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHMIX_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHMIX_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace s21 {
+
+/**
+ * @brief Перемешивает биты хеша (финализатор MurmurHash3).
+ *
+ * @param h Исходное значение хеш-функции.
+ * @return Значение, у которого каждый бит зависит от всех битов исходного.
+ */
+inline std::size_t hash_mix(std::size_t h) {
+  std::uint64_t x = h;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return static_cast<std::size_t>(x);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHMIX_H_
@@ -0,0 +1,137 @@
+/**
+ * @file hashset.h
+ * @brief Общая реализация неупорядоченных множеств.
+ *
+ * Класс HashSet хранит уникальные ключи в хеш-таблице с открытой адресацией
+ * и предоставляет интерфейс s21::set. На нем построены unordered_set
+ * (RobinHoodTable) и flat_hash_set (GroupTable).
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHSET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHSET_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * @brief Ключом элемента множества является сам элемент.
+ */
+template <typename Key>
+struct IdentityKeyOf {
+  const Key& operator()(const Key& key) const { return key; }
+};
+
+/**
+ * @class HashSet
+ * @brief Множество поверх хеш-таблицы с открытой адресацией.
+ *
+ * Общая реализация unordered_set и flat_hash_set: интерфейс повторяет
+ * s21::set, а размещение элементов определяет таблица TableT. Ключи доступны
+ * только для чтения: их изменение нарушило бы размещение в таблице.
+ *
+ * @tparam TableT Шаблон таблицы (RobinHoodTable или GroupTable).
+ */
+template <typename Key, typename Hash, typename KeyEqual,
+          template <typename, typename, typename, typename, typename>
+          class TableT>
+class HashSet {
+  using Table = TableT<Key, Key, IdentityKeyOf<Key>, Hash, KeyEqual>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = typename Table::ConstIterator;
+  using const_iterator = typename Table::ConstIterator;
+
+  HashSet() = default;
+  explicit HashSet(size_type bucket_count, const Hash& hash = Hash(),
+                   const KeyEqual& equal = KeyEqual())
+      : table_(bucket_count, hash, equal) {}
+  HashSet(std::initializer_list<value_type> const& items) {
+    table_.reserve(items.size());
+    for (const auto& item : items) {
+      table_.insert(item);
+    }
+  }
+  HashSet(const HashSet& s) = default;
+  HashSet(HashSet&& s) noexcept = default;
+  HashSet& operator=(const HashSet& s) = default;
+  HashSet& operator=(HashSet&& s) noexcept = default;
+  ~HashSet() = default;
+
+  iterator begin() const { return table_.cbegin(); }
+  iterator end() const { return table_.cend(); }
+
+  [[nodiscard]] size_type size() const { return table_.size(); }
+  [[nodiscard]] bool empty() const { return table_.empty(); }
+  [[nodiscard]] size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(Key);
+  }
+
+  void clear() { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    auto result = table_.insert(value);
+    return {iterator(result.first), result.second};
+  }
+
+  void erase(iterator pos) {
+    if (pos != end()) {
+      table_.erase(pos);
+    }
+  }
+
+  size_type erase(const Key& key) { return table_.erase(key); }
+
+  void swap(HashSet& other) { table_.swap(other.table_); }
+
+  void merge(HashSet& other) {
+    if (this == &other) return;
+    for (const auto& value : other) {
+      table_.insert(value);
+    }
+    other.clear();
+  }
+
+  iterator find(const Key& key) const { return table_.find(key); }
+
+  bool contains(const Key& key) const { return table_.contains(key); }
+
+  // Вставка при открытой адресации может переставлять элементы, поэтому
+  // итераторы результата получаются повторным поиском после всех вставок.
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    table_.reserve(size() + sizeof...(args));
+    std::vector<std::pair<iterator, bool>> results = {
+        {end(), insert(args).second}...};
+    std::size_t i = 0;
+    ((results[i++].first = find(args)), ...);
+    return results;
+  }
+
+  // Управление корзинами и коэффициентом заполнения
+  size_type bucket_count() const { return table_.bucket_count(); }
+  float load_factor() const { return table_.load_factor(); }
+  float max_load_factor() const { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void rehash(size_type count) { table_.rehash(count); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+ private:
+  Table table_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_HASHSET_H_
@@ -0,0 +1,441 @@
+/**
+ * @file robinhoodtable.h
+ * @brief Хеш-таблица с открытой адресацией по схеме Robin Hood.
+ *
+ * Данный файл содержит класс RobinHoodTable, на котором построены контейнеры
+ * unordered_map и unordered_set. Элементы хранятся прямо в массиве слотов,
+ * коллизии разрешаются линейным пробированием. При вставке элемент, ушедший
+ * от своей корзины дальше, чем текущий владелец слота, занимает его место
+ * ("отнимает у богатых"), поэтому длины проб выравниваются, а неудачный поиск
+ * останавливается, как только встречает элемент ближе к своей корзине.
+ * Удаление сдвигает хвост кластера назад, надгробия не используются.
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_ROBINHOODTABLE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_ROBINHOODTABLE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "hashmix.h"
+
+namespace s21 {
+
+/**
+ * @class RobinHoodTable
+ * @brief Хеш-таблица с открытой адресацией.
+ *
+ * Размер массива слотов всегда степень двойки. Для каждого слота хранится
+ * расстояние элемента от его корзины плюс один (ноль означает пустой слот).
+ *
+ * @tparam Key Тип ключа.
+ * @tparam Value Тип хранимого элемента (ключ или пара ключ-значение).
+ * @tparam KeyOf Функтор, извлекающий ключ из элемента.
+ * @tparam Hash Хеш-функция для ключей.
+ * @tparam KeyEqual Предикат равенства ключей.
+ */
+template <typename Key, typename Value, typename KeyOf,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class RobinHoodTable {
+ public:
+  using size_type = std::size_t;
+
+  /// Коэффициент заполнения по умолчанию.
+  static constexpr float kDefaultMaxLoadFactor = 0.875f;
+  /// Признак отсутствия элемента в результатах поиска по индексу.
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  /**
+   * @brief Итератор по занятым слотам таблицы.
+   *
+   * @tparam Const Если true, итератор дает только чтение элементов.
+   */
+  template <bool Const>
+  class IteratorBase {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = Value;
+    using pointer = std::conditional_t<Const, const Value*, Value*>;
+    using reference = std::conditional_t<Const, const Value&, Value&>;
+    using iterator_category = std::forward_iterator_tag;
+    using TablePtr =
+        std::conditional_t<Const, const RobinHoodTable*, RobinHoodTable*>;
+
+    IteratorBase() : table_(nullptr), index_(0) {}
+    IteratorBase(TablePtr table, size_type index)
+        : table_(table), index_(index) {}
+    // Неконстантный итератор неявно приводится к константному
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorBase(const IteratorBase<OtherConst>& other)
+        : table_(other.table()), index_(other.index()) {}
+
+    reference operator*() const { return table_->slots_[index_]; }
+    pointer operator->() const { return &table_->slots_[index_]; }
+
+    IteratorBase& operator++() {
+      index_ = table_->nextOccupied(index_ + 1);
+      return *this;
+    }
+    IteratorBase operator++(int) {
+      IteratorBase tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool operator==(const IteratorBase& other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const IteratorBase& other) const {
+      return !(*this == other);
+    }
+
+    TablePtr table() const { return table_; }
+    size_type index() const { return index_; }
+
+   private:
+    TablePtr table_;
+    size_type index_;
+  };
+
+  using Iterator = IteratorBase<false>;
+  using ConstIterator = IteratorBase<true>;
+
+  /**
+   * @brief Создает таблицу, способную принять bucket_count слотов без
+   * перехеширования (или пустую таблицу без памяти при нуле).
+   */
+  explicit RobinHoodTable(size_type bucket_count = 0,
+                          const Hash& hash = Hash(),
+                          const KeyEqual& equal = KeyEqual())
+      : hash_(hash), equal_(equal) {
+    if (bucket_count > 0) {
+      rehash(bucket_count);
+    }
+  }
+
+  RobinHoodTable(const RobinHoodTable& other)
+      : hash_(other.hash_),
+        equal_(other.equal_),
+        max_load_factor_(other.max_load_factor_) {
+    allocate(other.capacity_);
+    // Копируем слоты по тем же индексам: раскладка остается корректной
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (other.info_[i] != 0) {
+        new (slots_ + i) Value(other.slots_[i]);
+        info_[i] = other.info_[i];
+        ++size_;
+      }
+    }
+  }
+
+  RobinHoodTable(RobinHoodTable&& other) noexcept
+      : hash_(std::move(other.hash_)),
+        equal_(std::move(other.equal_)),
+        max_load_factor_(other.max_load_factor_) {
+    steal(other);
+  }
+
+  RobinHoodTable& operator=(const RobinHoodTable& other) {
+    if (this != &other) {
+      RobinHoodTable tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  RobinHoodTable& operator=(RobinHoodTable&& other) noexcept {
+    if (this != &other) {
+      release();
+      hash_ = std::move(other.hash_);
+      equal_ = std::move(other.equal_);
+      max_load_factor_ = other.max_load_factor_;
+      steal(other);
+    }
+    return *this;
+  }
+
+  ~RobinHoodTable() { release(); }
+
+  Iterator begin() { return Iterator(this, nextOccupied(0)); }
+  Iterator end() { return Iterator(this, capacity_); }
+  ConstIterator cbegin() const { return ConstIterator(this, nextOccupied(0)); }
+  ConstIterator cend() const { return ConstIterator(this, capacity_); }
+
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_type bucket_count() const { return capacity_; }
+
+  float load_factor() const {
+    return capacity_ == 0 ? 0.0f
+                          : static_cast<float>(size_) /
+                                static_cast<float>(capacity_);
+  }
+  float max_load_factor() const { return max_load_factor_; }
+
+  /**
+   * @brief Задает максимальный коэффициент заполнения.
+   *
+   * Значение ограничивается диапазоном [0.1, 0.95]: при полном заполнении
+   * пробирование при вставке не завершилось бы. Если текущее заполнение
+   * превышает новое значение, таблица увеличивается.
+   */
+  void max_load_factor(float ml) {
+    max_load_factor_ = std::min(std::max(ml, 0.1f), 0.95f);
+    threshold_ = thresholdFor(capacity_);
+    if (size_ > threshold_) {
+      rehash(0);
+    }
+  }
+
+  /**
+   * @brief Перестраивает таблицу с числом слотов не меньше count.
+   *
+   * Число слотов округляется вверх до степени двойки и не может стать
+   * меньше, чем нужно для текущего числа элементов.
+   */
+  void rehash(size_type count) {
+    size_type capacity = 8;
+    while (capacity < count || thresholdFor(capacity) < size_) {
+      capacity *= 2;
+    }
+    if (capacity != capacity_) {
+      relocate(capacity);
+    }
+  }
+
+  /// Готовит таблицу к хранению count элементов без перехеширования.
+  void reserve(size_type count) {
+    size_type needed = static_cast<size_type>(
+        std::ceil(static_cast<float>(count) / max_load_factor_));
+    if (needed > capacity_) {
+      rehash(needed);
+    }
+  }
+
+  /// Удаляет все элементы, сохраняя выделенную память.
+  void clear() {
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (info_[i] != 0) {
+        slots_[i].~Value();
+        info_[i] = 0;
+      }
+    }
+    size_ = 0;
+  }
+
+  void swap(RobinHoodTable& other) noexcept {
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+    std::swap(slots_, other.slots_);
+    std::swap(info_, other.info_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(mask_, other.mask_);
+    std::swap(size_, other.size_);
+    std::swap(threshold_, other.threshold_);
+  }
+
+  Iterator find(const Key& key) {
+    size_type index = findIndex(key);
+    return index == npos ? end() : Iterator(this, index);
+  }
+
+  ConstIterator find(const Key& key) const {
+    size_type index = findIndex(key);
+    return index == npos ? cend() : ConstIterator(this, index);
+  }
+
+  bool contains(const Key& key) const { return findIndex(key) != npos; }
+
+  /**
+   * @brief Вставляет элемент, если его ключа еще нет в таблице.
+   *
+   * @return Пара из итератора на элемент с этим ключом и признака вставки.
+   */
+  template <typename V>
+  std::pair<Iterator, bool> insert(V&& value) {
+    size_type index = findIndex(KeyOf()(value));
+    if (index != npos) {
+      return {Iterator(this, index), false};
+    }
+    Value element(std::forward<V>(value));
+    if (size_ + 1 > threshold_) {
+      rehash(capacity_ * 2);
+    }
+    return {Iterator(this, place(std::move(element))), true};
+  }
+
+  /**
+   * @brief Удаляет элемент с указанным ключом.
+   *
+   * @return Количество удаленных элементов (0 или 1).
+   */
+  size_type erase(const Key& key) {
+    size_type index = findIndex(key);
+    if (index == npos) return 0;
+    eraseIndex(index);
+    return 1;
+  }
+
+  /**
+   * @brief Удаляет элемент, на который указывает итератор.
+   *
+   * Хвост кластера сдвигается назад, поэтому на место удаленного элемента
+   * может встать следующий. Остальные итераторы становятся недействительными.
+   */
+  void erase(ConstIterator pos) {
+    if (pos.index() < capacity_ && info_[pos.index()] != 0) {
+      eraseIndex(pos.index());
+    }
+  }
+
+ private:
+  Value* slots_ = nullptr;
+  std::uint32_t* info_ = nullptr;
+  size_type capacity_ = 0;
+  size_type mask_ = 0;
+  size_type size_ = 0;
+  size_type threshold_ = 0;
+  Hash hash_;
+  KeyEqual equal_;
+  float max_load_factor_ = kDefaultMaxLoadFactor;
+
+  size_type thresholdFor(size_type capacity) const {
+    return static_cast<size_type>(static_cast<float>(capacity) *
+                                  max_load_factor_);
+  }
+
+  size_type homeOf(const Key& key) const {
+    return hash_mix(hash_(key)) & mask_;
+  }
+
+  size_type nextOccupied(size_type index) const {
+    while (index < capacity_ && info_[index] == 0) {
+      ++index;
+    }
+    return index;
+  }
+
+  /**
+   * @brief Ищет индекс слота с ключом.
+   *
+   * Поиск прекращается на первом слоте, элемент которого ближе к своей
+   * корзине, чем искомый ключ был бы на этой позиции: по инварианту Robin
+   * Hood дальше ключа быть не может.
+   */
+  size_type findIndex(const Key& key) const {
+    if (size_ == 0) return npos;
+    size_type index = homeOf(key);
+    for (std::uint32_t dist = 1; dist <= info_[index]; ++dist) {
+      if (info_[index] == dist && equal_(KeyOf()(slots_[index]), key)) {
+        return index;
+      }
+      index = (index + 1) & mask_;
+    }
+    return npos;
+  }
+
+  /**
+   * @brief Размещает элемент, ключа которого заведомо нет в таблице.
+   *
+   * @return Индекс слота, в который попал размещаемый элемент.
+   */
+  size_type place(Value&& value) {
+    size_type index = homeOf(KeyOf()(value));
+    size_type result = npos;
+    std::uint32_t dist = 1;
+    while (info_[index] != 0) {
+      if (info_[index] < dist) {
+        // Текущий владелец ближе к своей корзине: занимаем его слот
+        std::swap(value, slots_[index]);
+        std::swap(dist, info_[index]);
+        if (result == npos) result = index;
+      }
+      ++dist;
+      index = (index + 1) & mask_;
+    }
+    new (slots_ + index) Value(std::move(value));
+    info_[index] = dist;
+    ++size_;
+    return result == npos ? index : result;
+  }
+
+  void eraseIndex(size_type index) {
+    slots_[index].~Value();
+    info_[index] = 0;
+    --size_;
+    // Сдвигаем назад элементы, стоящие не в своей корзине
+    size_type next = (index + 1) & mask_;
+    while (info_[next] > 1) {
+      new (slots_ + index) Value(std::move(slots_[next]));
+      slots_[next].~Value();
+      info_[index] = info_[next] - 1;
+      info_[next] = 0;
+      index = next;
+      next = (next + 1) & mask_;
+    }
+  }
+
+  void allocate(size_type capacity) {
+    slots_ = capacity ? std::allocator<Value>().allocate(capacity) : nullptr;
+    info_ = capacity ? new std::uint32_t[capacity]() : nullptr;
+    capacity_ = capacity;
+    mask_ = capacity ? capacity - 1 : 0;
+    size_ = 0;
+    threshold_ = thresholdFor(capacity);
+  }
+
+  void release() {
+    clear();
+    if (slots_ != nullptr) {
+      std::allocator<Value>().deallocate(slots_, capacity_);
+    }
+    delete[] info_;
+    slots_ = nullptr;
+    info_ = nullptr;
+    capacity_ = mask_ = threshold_ = 0;
+  }
+
+  void relocate(size_type capacity) {
+    Value* old_slots = slots_;
+    std::uint32_t* old_info = info_;
+    size_type old_capacity = capacity_;
+    allocate(capacity);
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (old_info[i] != 0) {
+        place(std::move(old_slots[i]));
+        old_slots[i].~Value();
+      }
+    }
+    if (old_slots != nullptr) {
+      std::allocator<Value>().deallocate(old_slots, old_capacity);
+    }
+    delete[] old_info;
+  }
+
+  void steal(RobinHoodTable& other) noexcept {
+    slots_ = other.slots_;
+    info_ = other.info_;
+    capacity_ = other.capacity_;
+    mask_ = other.mask_;
+    size_ = other.size_;
+    threshold_ = other.threshold_;
+    other.slots_ = nullptr;
+    other.info_ = nullptr;
+    other.capacity_ = other.mask_ = other.size_ = other.threshold_ = 0;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_HASHTABLE_ROBINHOODTABLE_H_
@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_set>
+
+#include "grouptable.h"
+#include "robinhoodtable.h"
+
+namespace {
+
+struct IntKeyOf {
+  const int& operator()(const int& key) const { return key; }
+};
+
+// Хеш, отправляющий все ключи в одну корзину, для проверки кластеров
+struct CollidingHash {
+  std::size_t operator()(int) const { return 0; }
+};
+
+using Table = s21::RobinHoodTable<int, int, IntKeyOf>;
+using Groups = s21::GroupTable<int, int, IntKeyOf>;
+
+// Временно отключает AVX2, чтобы проверить SSE2/скалярный поиск
+class ScopedNoAvx2 {
+ public:
+  ScopedNoAvx2() : saved_(s21::simd::cpu_features().avx2) {
+    s21::simd::cpu_features().avx2 = false;
+  }
+  ~ScopedNoAvx2() { s21::simd::cpu_features().avx2 = saved_; }
+
+ private:
+  bool saved_;
+};
+
+void RandomOperations(Groups& table, unsigned seed) {
+  std::unordered_set<int> reference;
+  std::mt19937 rng(seed);
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 3000) - 1000;
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(table.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(table.insert(key).second, reference.insert(key).second);
+    }
+    if (step % 97 == 0) {
+      ASSERT_EQ(table.contains(key), reference.count(key) == 1);
+    }
+  }
+  ASSERT_EQ(table.size(), reference.size());
+  std::size_t visited = 0;
+  for (auto it = table.cbegin(); it != table.cend(); ++it, ++visited) {
+    ASSERT_TRUE(reference.count(*it));
+  }
+  EXPECT_EQ(visited, reference.size());
+  for (int key = -1000; key < 2000; ++key) {
+    ASSERT_EQ(table.contains(key), reference.count(key) == 1);
+  }
+}
+
+}  // namespace
+
+TEST(RobinHoodTableTest, InsertFindErase) {
+  Table table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.bucket_count(), 0U);
+  EXPECT_FALSE(table.contains(1));
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(table.insert(i).second);
+  }
+  EXPECT_FALSE(table.insert(5).second);
+  EXPECT_EQ(table.size(), 1000U);
+  EXPECT_LE(table.load_factor(), table.max_load_factor());
+
+  for (int i = 0; i < 1000; i += 2) {
+    ASSERT_EQ(table.erase(i), 1U);
+  }
+  EXPECT_EQ(table.erase(0), 0U);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(table.contains(i), i % 2 == 1);
+  }
+}
+
+TEST(RobinHoodTableTest, InsertReturnsPlacedElement) {
+  s21::RobinHoodTable<int, int, IntKeyOf, CollidingHash> table(64);
+  // Все ключи конкурируют за один кластер, элементы переставляются
+  for (int i = 0; i < 40; ++i) {
+    auto result = table.insert(i);
+    ASSERT_TRUE(result.second);
+    ASSERT_EQ(*result.first, i);
+  }
+  // Удаление из середины кластера сдвигает хвост назад
+  table.erase(10);
+  table.erase(0);
+  for (int i = 0; i < 40; ++i) {
+    ASSERT_EQ(table.contains(i), i != 10 && i != 0);
+  }
+}
+
+TEST(RobinHoodTableTest, RandomOperationsMatchStd) {
+  Table table;
+  std::unordered_set<int> reference;
+  std::mt19937 rng(7);
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 2000);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(table.erase(key), reference.erase(key));
+    } else {
+      ASSERT_EQ(table.insert(key).second, reference.insert(key).second);
+    }
+  }
+  ASSERT_EQ(table.size(), reference.size());
+  std::size_t visited = 0;
+  for (auto it = table.cbegin(); it != table.cend(); ++it, ++visited) {
+    ASSERT_TRUE(reference.count(*it));
+  }
+  EXPECT_EQ(visited, reference.size());
+}
+
+TEST(RobinHoodTableTest, LoadFactorAndRehash) {
+  Table table;
+  table.max_load_factor(0.5f);
+  EXPECT_FLOAT_EQ(table.max_load_factor(), 0.5f);
+  table.reserve(100);
+  EXPECT_GE(table.bucket_count(), 200U);
+  std::size_t buckets = table.bucket_count();
+  for (int i = 0; i < 100; ++i) table.insert(i);
+  EXPECT_EQ(table.bucket_count(), buckets);
+
+  table.max_load_factor(5.0f);  // ограничивается сверху
+  EXPECT_FLOAT_EQ(table.max_load_factor(), 0.95f);
+  table.rehash(0);
+  EXPECT_LT(table.bucket_count(), buckets);
+  for (int i = 0; i < 100; ++i) ASSERT_TRUE(table.contains(i));
+}
+
+TEST(RobinHoodTableTest, CopyAndMove) {
+  Table table;
+  for (int i = 0; i < 50; ++i) table.insert(i);
+  Table copy(table);
+  Table moved(std::move(table));
+  EXPECT_EQ(table.size(), 0U);
+  EXPECT_EQ(copy.size(), 50U);
+  EXPECT_EQ(moved.size(), 50U);
+  copy.erase(3);
+  EXPECT_TRUE(moved.contains(3));
+  table = copy;
+  EXPECT_EQ(table.size(), 49U);
+}
+
+TEST(GroupTableTest, InsertFindErase) {
+  Groups table;
+  EXPECT_EQ(table.bucket_count(), 0U);
+  EXPECT_FALSE(table.contains(1));
+  for (int i = 0; i < 1000; ++i) {
+    auto result = table.insert(i);
+    ASSERT_TRUE(result.second);
+    ASSERT_EQ(*result.first, i);
+  }
+  EXPECT_FALSE(table.insert(5).second);
+  EXPECT_EQ(table.size(), 1000U);
+  EXPECT_LE(table.load_factor(), table.max_load_factor());
+  EXPECT_EQ(table.bucket_count() % Groups::kGroupSlots, 0U);
+
+  for (int i = 0; i < 1000; i += 2) {
+    ASSERT_EQ(table.erase(i), 1U);
+  }
+  EXPECT_EQ(table.erase(0), 0U);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(table.contains(i), i % 2 == 1);
+  }
+}
+
+TEST(GroupTableTest, RandomOperationsMatchStd) {
+  Groups table;
+  RandomOperations(table, 11);
+}
+
+TEST(GroupTableTest, RandomOperationsWithoutAvx2) {
+  ScopedNoAvx2 guard;
+  Groups table;
+  RandomOperations(table, 12);
+}
+
+TEST(GroupTableTest, CollidingHashOverflowsGroups) {
+  // Все ключи попадают в одну группу и переливаются в следующие
+  s21::GroupTable<int, int, IntKeyOf, CollidingHash> table(128);
+  for (int i = 0; i < 100; ++i) ASSERT_TRUE(table.insert(i).second);
+  for (int i = 0; i < 100; i += 3) table.erase(i);
+  for (int i = 0; i < 120; ++i) {
+    ASSERT_EQ(table.contains(i), i < 100 && i % 3 != 0);
+  }
+  {
+    ScopedNoAvx2 guard;
+    for (int i = 0; i < 120; ++i) {
+      ASSERT_EQ(table.contains(i), i < 100 && i % 3 != 0);
+    }
+  }
+}
+
+TEST(GroupTableTest, ChurnRehashesInPlace) {
+  Groups table;
+  table.reserve(500);
+  std::size_t buckets = table.bucket_count();
+  // Постоянный размер при сменяющихся ключах: устаревшие биты переполнения
+  // должны сбрасываться перехешированием на месте, а не ростом таблицы
+  for (int i = 0; i < 300; ++i) table.insert(i);
+  for (int i = 300; i < 200000; ++i) {
+    table.insert(i);
+    table.erase(i - 300);
+  }
+  EXPECT_EQ(table.size(), 300U);
+  EXPECT_EQ(table.bucket_count(), buckets);
+  for (int i = 200000 - 400; i < 200000; ++i) {
+    ASSERT_EQ(table.contains(i), i >= 200000 - 300);
+  }
+
+  table.rehash(buckets);  // то же число групп: перехеширование на месте
+  EXPECT_EQ(table.bucket_count(), buckets);
+  for (int i = 200000 - 300; i < 200000; ++i) ASSERT_TRUE(table.contains(i));
+}
+
+TEST(GroupTableTest, LoadFactorCopyAndMove) {
+  Groups table;
+  table.max_load_factor(0.5f);
+  table.reserve(100);
+  EXPECT_GE(table.bucket_count(), 200U);
+  std::size_t buckets = table.bucket_count();
+  for (int i = 0; i < 100; ++i) table.insert(i);
+  EXPECT_EQ(table.bucket_count(), buckets);
+
+  Groups copy(table);
+  Groups moved(std::move(table));
+  EXPECT_EQ(table.size(), 0U);
+  EXPECT_EQ(copy.size(), 100U);
+  copy.erase(3);
+  EXPECT_TRUE(moved.contains(3));
+  EXPECT_FALSE(copy.contains(3));
+  table = copy;
+  EXPECT_EQ(table.size(), 99U);
+  table.clear();
+  EXPECT_TRUE(table.empty());
+  EXPECT_TRUE(table.cbegin() == table.cend());
+  EXPECT_TRUE(table.insert(3).second);
+}
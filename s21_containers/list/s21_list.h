@@ -8,6 +8,10 @@
  * Эта реализация list обеспечивает постоянное время для вставки и удаления
  * элементов на любой позиции, при условии, что у вас есть итератор на позицию.
  *
+ * Узлы выделяются через аллокатор, переданный вторым параметром шаблона
+ * (std::allocator по умолчанию). Для очередей с частыми push/pop подходит
+ * s21::node_pool_allocator, который переиспользует освобожденные узлы.
+ *
  * @author [emerosro]
  * @version 1.0
  */
@@ -16,7 +20,13 @@
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_LIST_S21_LIST_H_
 
 #include <cstddef>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -106,11 +116,12 @@ class ListConstIterator : public ListIteratorBase<T> {
   }
 };
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   // -----List Member type----------------
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
@@ -119,23 +130,38 @@ class list {
   using const_iterator = ListConstIterator<T>;
   // -----------END-----------------------
 
+ private:
+  using NodeAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+ public:
   // --------List Functions---------------
   list() : head_(nullptr), tail_(nullptr), size_(0) {}
 
-  list(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
+  explicit list(const allocator_type &alloc)
+      : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc) {}
+
+  list(size_type n, const allocator_type &alloc = allocator_type())
+      : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc) {
     for (size_type i = 0; i < n; ++i) {
       push_back(value_type());
     }
   }
 
-  list(std::initializer_list<value_type> const &items)
-      : head_(nullptr), tail_(nullptr), size_(0) {
+  list(std::initializer_list<value_type> const &items,
+       const allocator_type &alloc = allocator_type())
+      : head_(nullptr), tail_(nullptr), size_(0), alloc_(alloc) {
     for (const auto &item : items) {
       push_back(item);
     }
   }
 
-  list(const list &l) : head_(nullptr), tail_(nullptr), size_(0) {
+  list(const list &l)
+      : head_(nullptr),
+        tail_(nullptr),
+        size_(0),
+        alloc_(NodeTraits::select_on_container_copy_construction(l.alloc_)) {
     Node *current = l.head_;
     while (current != nullptr) {
       push_back(current->data);
@@ -143,7 +169,11 @@ class list {
     }
   }
 
-  list(list &&l) : head_(l.head_), tail_(l.tail_), size_(l.size_) {
+  list(list &&l)
+      : head_(l.head_),
+        tail_(l.tail_),
+        size_(l.size_),
+        alloc_(std::move(l.alloc_)) {
     l.head_ = nullptr;
     l.tail_ = nullptr;
     l.size_ = 0;
@@ -151,15 +181,26 @@ class list {
 
   ~list() { clear(); }
 
+  /**
+   * @brief Перемещающее присваивание.
+   *
+   * Узлы l забираются целиком, если аллокатор переходит вместе с ними или
+   * аллокаторы равны; иначе элементы копируются в узлы своего аллокатора.
+   */
   list &operator=(list &&l) {
     if (this == &l) {
       return *this;
     }
-    Node *current = head_;
-    while (current != nullptr) {
-      Node *next_node = current->next;
-      delete current;
-      current = next_node;
+    clear();
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(l.alloc_);
+    } else if (!NodeTraits::is_always_equal::value && alloc_ != l.alloc_) {
+      for (Node *current = l.head_; current != nullptr;
+           current = current->next) {
+        push_back(current->data);
+      }
+      l.clear();
+      return *this;
     }
     head_ = l.head_;
     tail_ = l.tail_;
@@ -175,7 +216,11 @@ class list {
     if (this == &l) {
       return *this;
     }
+    // Узлы освобождаются старым аллокатором до того, как принят новый
     clear();
+    if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+      alloc_ = l.alloc_;
+    }
     Node *current = l.head_;
     while (current != nullptr) {
       push_back(current->data);
@@ -184,6 +229,8 @@ class list {
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+
   //--------------END--------------------
 
   //--------List Element access----------
@@ -245,7 +292,7 @@ class list {
     Node *current = head_;
     while (current != nullptr) {
       Node *next_node = current->next;
-      delete current;
+      destroyNode(current);
       current = next_node;
     }
     head_ = nullptr;
@@ -255,7 +302,7 @@ class list {
 
   iterator insert(iterator pos, const_reference value) {
     Node *curNode = pos.getNode();
-    Node *newNode = new Node(value);
+    Node *newNode = createNode(value);
 
     if (head_ == nullptr) {
       // Вставка в пустой список
@@ -310,13 +357,13 @@ class list {
       tail_ = nullptr;
     }
     // Удаляем текущий узел
-    delete curNode;
+    destroyNode(curNode);
     // Уменьшаем размер списка
     --size_;
   }
 
   void push_back(const_reference value) {
-    Node *new_node = new Node(value);
+    Node *new_node = createNode(value);
     if (head_ == nullptr) {
       head_ = tail_ = new_node;
     } else {
@@ -348,44 +395,56 @@ class list {
   }
 
   void swap(list &other) {
+    if constexpr (NodeTraits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
     std::swap(head_, other.head_);
     std::swap(tail_, other.tail_);
     std::swap(size_, other.size_);
   }
 
-  void merge(list &other) {
-    iterator it_this = this->begin();
-    iterator it_other = other.begin();
-    list<value_type> temp_list;
-    // Слияние двух отсортированных списков
-    while (it_this != this->end() && it_other != other.end()) {
-      if (*it_this <= *it_other) {
-        temp_list.push_back(*it_this);
-        ++it_this;
-      } else {
-        temp_list.push_back(*it_other);
-        ++it_other;
-      }
-    }
-    // Если один из списков закончился, добавляем оставшиеся элементы
-    while (it_this != this->end()) {
-      temp_list.push_back(*it_this);
-      ++it_this;
+  /**
+   * @brief Сливает отсортированный список other в этот отсортированный
+   * список.
+   *
+   * Узлы other перевешиваются без копирования и выделения памяти; other
+   * становится пустым. Слияние устойчивое: из равных элементов первыми
+   * идут элементы этого списка. Если comp бросит исключение, все узлы
+   * other окажутся в этом списке, порядок элементов не гарантируется.
+   *
+   * @param other Отсортированный список с тем же аллокатором.
+   * @param comp Сравнение «меньше», по которому отсортированы оба списка.
+   */
+  template <typename Compare>
+  void merge(list &other, Compare comp) {
+    if (this == &other || other.head_ == nullptr) {
+      return;
     }
-    while (it_other != other.end()) {
-      temp_list.push_back(*it_other);
-      ++it_other;
+    // Последним станет хвост other, если он не меньше хвоста этого списка
+    Node *tail = other.tail_;
+    if (tail_ != nullptr && comp(other.tail_->data, tail_->data)) {
+      tail = tail_;
     }
-    // Заменяем исходный список отсортированными элементами
-    this->clear();
-    for (auto item : temp_list) {
-      this->push_back(item);
+    Node *first = head_;
+    Node *second = other.head_;
+    size_ += other.size_;
+    other.head_ = nullptr;
+    other.tail_ = nullptr;
+    other.size_ = 0;
+    try {
+      // mergeChains уже расставил prev, второй проход по узлам не нужен
+      head_ = mergeChains(first, second, comp);
+      tail_ = tail;
+    } catch (...) {
+      relink(first);
+      throw;
     }
-    // Очищаем второй список, так как его элементы теперь в первом списке
-    other.clear();
   }
 
-  // Этот метод необходим для сортировки слиянием
+  void merge(list &other) { merge(other, std::less<>()); }
+
+  // Добавляет в конец копии элементов отсортированных first и second в
+  // порядке слияния; first и second не меняются
   void merge(list &first, list &second) {
     auto it1 = first.begin();
     auto it2 = second.begin();
@@ -480,28 +539,61 @@ class list {
     }
   }
 
-  void sort() {
-    if (size_ <= 1) {
-      return;  // Список уже отсортирован
-    }
-    list first_half, second_half;
-    // Разделяем список на две половины
-    auto it = begin();
-    for (size_type i = 0; i < size_ / 2; ++i) {
-      first_half.push_back(*it);
-      ++it;
+  /**
+   * @brief Сортирует список устойчивой сортировкой слиянием снизу вверх.
+   *
+   * Узлы только перевешиваются: элементы не копируются, память не
+   * выделяется, итераторы и ссылки остаются действительными. Отсортированные
+   * серии длиной 2^i хранятся в bins[i], каждый следующий узел сливается с
+   * ними как перенос при двоичном сложении; всего O(n log n) сравнений и
+   * O(1) дополнительной памяти. Если comp бросит исключение, список
+   * сохранит все элементы в неопределенном порядке.
+   *
+   * @param comp Сравнение «меньше».
+   */
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) {
+      return;
     }
-    for (; it != end(); ++it) {
-      second_half.push_back(*it);
+    // 64 серии хватает для любого size_type
+    Node *bins[std::numeric_limits<size_type>::digits] = {};
+    Node *rest = head_;
+    Node *carry = nullptr;
+    Node *result = nullptr;
+    try {
+      while (rest != nullptr) {
+        carry = rest;
+        rest = rest->next;
+        carry->next = nullptr;
+        size_type i = 0;
+        for (; bins[i] != nullptr; ++i) {
+          // bins[i] содержит более ранние элементы, чем carry
+          carry = mergeChains(bins[i], carry, comp);
+        }
+        bins[i] = carry;
+        carry = nullptr;
+      }
+      // Старшие серии содержат более ранние элементы
+      for (Node *&bin : bins) {
+        if (result == nullptr) {
+          std::swap(result, bin);
+        } else if (bin != nullptr) {
+          result = mergeChains(bin, result, comp);
+        }
+      }
+    } catch (...) {
+      // Собираем все узлы обратно в одну цепочку
+      Node *all = concat(carry, concat(result, rest));
+      for (Node *chain : bins) all = concat(chain, all);
+      relink(all);
+      throw;
     }
-    // Рекурсивно сортируем каждую половину
-    first_half.sort();
-    second_half.sort();
-    // Сливаем две отсортированные половины
-    clear();
-    merge(first_half, second_half);
+    relink(result);
   }
 
+  void sort() { sort(std::less<>()); }
+
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
     (insert(pos, std::forward<Args>(args)), ...);
@@ -528,6 +620,88 @@ class list {
   Node *head_;
   Node *tail_;
   size_type size_;
+  NodeAllocator alloc_;
+
+  Node *createNode(const_reference value) {
+    Node *node = NodeTraits::allocate(alloc_, 1);
+    try {
+      NodeTraits::construct(alloc_, node, value);
+    } catch (...) {
+      NodeTraits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(Node *node) {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+  }
+
+  /**
+   * @brief Сливает цепочки по next, first и second, и возвращает начало
+   * результата; при равенстве первым идет узел из first. Поле prev узлов
+   * результата тоже расставляется.
+   *
+   * Обе цепочки после вызова пусты. Если comp бросит исключение, все узлы
+   * собираются в first, second становится пустой.
+   */
+  template <typename Compare>
+  static Node *mergeChains(Node *&first, Node *&second, Compare &comp) {
+    Node *result = nullptr;
+    Node **out = &result;
+    Node *last = nullptr;
+    try {
+      while (first != nullptr && second != nullptr) {
+        if (comp(second->data, first->data)) {
+          *out = second;
+          second = second->next;
+        } else {
+          *out = first;
+          first = first->next;
+        }
+        (*out)->prev = last;
+        last = *out;
+        out = &last->next;
+      }
+    } catch (...) {
+      *out = concat(first, second);
+      first = result;
+      second = nullptr;
+      throw;
+    }
+    *out = first != nullptr ? first : second;
+    if (*out != nullptr) {
+      (*out)->prev = last;
+    }
+    first = nullptr;
+    second = nullptr;
+    return result;
+  }
+
+  /// Присоединяет цепочку tail к концу цепочки chain.
+  static Node *concat(Node *chain, Node *tail) {
+    if (chain == nullptr) {
+      return tail;
+    }
+    Node *last = chain;
+    while (last->next != nullptr) {
+      last = last->next;
+    }
+    last->next = tail;
+    return chain;
+  }
+
+  /// Делает цепочку по next содержимым списка: восстанавливает prev и tail.
+  void relink(Node *chain) {
+    head_ = chain;
+    Node *prev = nullptr;
+    for (Node *node = chain; node != nullptr; node = node->next) {
+      node->prev = prev;
+      prev = node;
+    }
+    tail_ = prev;
+  }
 };
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_LIST_S21_LIST_H_
\ No newline at end of file
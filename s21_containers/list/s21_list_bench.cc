@@ -0,0 +1,92 @@
+// Бенчмарк очереди на s21::list с частыми push/pop: узлы из кучи
+// (std::allocator) против s21::node_pool_allocator. Первый сценарий держит
+// в очереди [глубина] элементов и на каждом шаге делает push_back и
+// pop_front, второй заполняет очередь пачкой и опустошает ее. Печатается
+// время на операцию в наносекундах для одного и нескольких потоков (у
+// каждого потока своя очередь).
+//
+// Запуск: ./bench.out [операций на поток] [глубина] [потоков]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "s21_list.h"
+#include "s21_node_pool_allocator.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename List>
+long Churn(std::size_t operations, std::size_t depth) {
+  List queue;
+  for (std::size_t i = 0; i < depth; ++i) queue.push_back(static_cast<int>(i));
+  long checksum = 0;
+  for (std::size_t i = 0; i < operations; ++i) {
+    queue.push_back(static_cast<int>(i));
+    checksum += queue.front();
+    queue.pop_front();
+  }
+  return checksum;
+}
+
+template <typename List>
+long Burst(std::size_t operations, std::size_t depth) {
+  List queue;
+  long checksum = 0;
+  for (std::size_t done = 0; done < operations; done += depth) {
+    for (std::size_t i = 0; i < depth; ++i) {
+      queue.push_back(static_cast<int>(i));
+    }
+    while (!queue.empty()) {
+      checksum += queue.front();
+      queue.pop_front();
+    }
+  }
+  return checksum;
+}
+
+template <typename Scenario>
+double NsPerOp(Scenario scenario, std::size_t operations, std::size_t depth,
+               std::size_t threads) {
+  auto start = Clock::now();
+  std::vector<std::thread> workers;
+  std::vector<long> checksums(threads);
+  for (std::size_t t = 0; t < threads; ++t) {
+    workers.emplace_back(
+        [&, t] { checksums[t] = scenario(operations, depth); });
+  }
+  for (std::thread &worker : workers) worker.join();
+  if (checksums[0] == 42) std::printf("\n");  // не дает выбросить замер
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+             .count() /
+         static_cast<double>(operations * threads);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t operations =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+  std::size_t depth = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1024;
+  std::size_t max_threads = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 4;
+  if (depth == 0) depth = 1;
+
+  using Heap = s21::list<int>;
+  using Pooled = s21::list<int, s21::node_pool_allocator<int>>;
+  std::printf("%zu operations per thread, depth %zu, ns per push+pop\n",
+              operations, depth);
+  std::printf("  %-8s %12s %12s %12s %12s\n", "threads", "churn heap",
+              "churn pool", "burst heap", "burst pool");
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    std::printf("  %-8zu %12.1f %12.1f %12.1f %12.1f\n", threads,
+                NsPerOp(Churn<Heap>, operations, depth, threads),
+                NsPerOp(Churn<Pooled>, operations, depth, threads),
+                NsPerOp(Burst<Heap>, operations, depth, threads),
+                NsPerOp(Burst<Pooled>, operations, depth, threads));
+  }
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Бенчмарк сортировки и слияния списков: s21::list::sort и merge
+// (перевешивание узлов) против std::list. Список из [узлов] случайных int
+// сортируется целиком, затем две отсортированные половины сливаются.
+// Печатается время в миллисекундах.
+//
+// Запуск: ./bench.out [узлов]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+
+#include "s21_list.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename F>
+double Ms(F f) {
+  auto start = Clock::now();
+  f();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename List>
+void Run(const char *name, std::size_t size) {
+  std::mt19937 rng(1);
+  List list, first, second;
+  for (std::size_t i = 0; i < size; ++i) {
+    int value = static_cast<int>(rng());
+    list.push_back(value);
+    (i % 2 == 0 ? first : second).push_back(value);
+  }
+  double sort_ms = Ms([&] { list.sort(); });
+  first.sort();
+  second.sort();
+  double merge_ms = Ms([&] { first.merge(second); });
+  if (list.front() != first.front() || list.back() != first.back()) {
+    std::printf("result mismatch\n");
+  }
+  std::printf("  %-12s %10.1f %10.1f\n", name, sort_ms, merge_ms);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+  std::printf("%zu random ints, ms\n", size);
+  std::printf("  %-12s %10s %10s\n", "", "sort", "merge");
+  Run<s21::list<int>>("s21::list", size);
+  Run<std::list<int>>("std::list", size);
+  return 0;
+}
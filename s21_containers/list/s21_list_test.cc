@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
 #include <list>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "../../s21_containers.h"
+#include "../test_support/tracking_resource.h"
 
 // Тестирование конструктора по умолчанию
 TEST(List, Constructor_Default) {
@@ -672,3 +679,146 @@ TEST(ListTest, DecrementIterator) {
   EXPECT_EQ(it, myList.end());  // после декремента итератор первого элемента
                                 // должен стать end()
 }
+
+TEST(List, NodePoolAllocator) {
+  using Pooled = s21::list<std::string, s21::node_pool_allocator<std::string>>;
+  Pooled list{"a", "b", "c"};
+  list.push_front("z");
+  list.erase(++list.begin());
+  list.pop_back();
+  EXPECT_EQ(list.size(), 2U);
+  EXPECT_EQ(list.front(), "z");
+  EXPECT_EQ(list.back(), "b");
+
+  // освобожденные узлы переиспользуются, новых кусков памяти не нужно
+  for (int round = 0; round < 1000; ++round) {
+    list.push_back(std::string(30, 'x'));
+    list.pop_front();
+  }
+  std::size_t chunks = s21::node_pool_allocator<std::string>::chunk_count();
+  for (int round = 0; round < 1000; ++round) {
+    list.push_back("y");
+    list.pop_front();
+  }
+  EXPECT_EQ(s21::node_pool_allocator<std::string>::chunk_count(), chunks);
+
+  Pooled copy = list;
+  Pooled moved;
+  moved = std::move(list);
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(moved.size(), copy.size());
+  copy.sort();
+  copy.merge(moved);
+  EXPECT_EQ(copy.size(), 4U);
+}
+
+TEST(List, NodePoolAllocatorAcrossThreads) {
+  using Pooled = s21::list<long, s21::node_pool_allocator<long>>;
+  std::vector<Pooled> lists(4);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < lists.size(); ++t) {
+    threads.emplace_back([&lists, t] {
+      for (long i = 0; i < 5000; ++i) lists[t].push_back(i);
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  threads.clear();
+  // узлы, созданные в одном потоке, освобождаются в другом
+  for (std::size_t t = 0; t < lists.size(); ++t) {
+    threads.emplace_back([&lists, t] {
+      Pooled &list = lists[(t + 1) % lists.size()];
+      long sum = 0;
+      while (!list.empty()) {
+        sum += list.front();
+        list.pop_front();
+      }
+      EXPECT_EQ(sum, 4999L * 5000 / 2);
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+}
+
+TEST(List, CopyAssignmentPropagatesAllocator) {
+  using s21::test_support::TrackingResource;
+  using Allocator = s21::test_support::CopyPropagatingAllocator<int>;
+  TrackingResource first, second;
+  {
+    s21::list<int, Allocator> target(Allocator{&first});
+    s21::list<int, Allocator> source(Allocator{&second});
+    for (int i = 0; i < 10; ++i) {
+      target.push_back(i);
+      source.push_back(-i);
+    }
+    // узлы target возвращаются в first, новые берутся из second
+    target = source;
+    EXPECT_TRUE(first.live.empty());
+    EXPECT_EQ(target.get_allocator().resource, &second);
+    EXPECT_EQ(target.size(), 10U);
+    EXPECT_EQ(target.back(), -9);
+  }
+  EXPECT_EQ(first.foreign, 0);
+  EXPECT_EQ(second.foreign, 0);
+  EXPECT_TRUE(second.live.empty());
+}
+
+namespace {
+
+// Итераторы s21::list не описывают iterator_traits: копируем вручную
+template <typename T>
+std::vector<T> ToVector(s21::list<T> &list) {
+  std::vector<T> values;
+  for (const T &value : list) values.push_back(value);
+  return values;
+}
+
+}  // namespace
+
+TEST(List, SortRelinksNodes) {
+  std::mt19937 rng(7);
+  s21::list<std::pair<int, int>> s21_list;
+  std::vector<std::pair<int, int>> expected;
+  for (int i = 0; i < 1000; ++i) {
+    std::pair<int, int> value(static_cast<int>(rng() % 50), i);
+    s21_list.push_back(value);
+    expected.push_back(value);
+  }
+  const std::pair<int, int> *first = &s21_list.front();
+  auto by_key = [](const auto &a, const auto &b) { return a.first > b.first; };
+  s21_list.sort(by_key);
+  // устойчивая сортировка по убыванию ключа без копирования узлов
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  EXPECT_EQ(ToVector(s21_list), expected);
+  bool node_kept = false;
+  for (const auto &value : s21_list) node_kept = node_kept || &value == first;
+  EXPECT_TRUE(node_kept);
+  EXPECT_EQ(*--s21_list.end(), expected.back());
+
+  s21::list<std::pair<int, int>> other{{49, -1}, {10, -2}, {-1, -3}};
+  s21_list.merge(other, by_key);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s21_list.size(), 1003U);
+  EXPECT_EQ(s21_list.back(), std::make_pair(-1, -3));
+  std::vector<std::pair<int, int>> merged = ToVector(s21_list);
+  EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end(), by_key));
+  // равные ключи: сначала элементы этого списка
+  auto last_49 = std::find_if(merged.rbegin(), merged.rend(),
+                              [](const auto &v) { return v.first == 49; });
+  EXPECT_EQ(*last_49, std::make_pair(49, -1));
+}
+
+TEST(List, SortKeepsElementsWhenCompareThrows) {
+  s21::list<int> list{5, 3, 8, 1, 4, 9, 2, 7};
+  int calls = 0;
+  auto throwing = [&calls](int a, int b) {
+    if (++calls == 6) throw std::runtime_error("compare");
+    return a < b;
+  };
+  EXPECT_THROW(list.sort(throwing), std::runtime_error);
+  std::vector<int> values = ToVector(list);
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(values, (std::vector<int>{1, 2, 3, 4, 5, 7, 8, 9}));
+  EXPECT_EQ(list.size(), 8U);
+  list.sort(std::greater<>());
+  EXPECT_EQ(ToVector(list), (std::vector<int>{9, 8, 7, 5, 4, 3, 2, 1}));
+  EXPECT_EQ(*--list.end(), 1);
+}
@@ -0,0 +1,240 @@
+/**
+ * @file s21_node_pool_allocator.h
+ * @brief Аллокатор узлов фиксированного размера с пулом и кэшем потока.
+ *
+ * node_pool_allocator выделяет одиночные объекты (n == 1) из пула блоков
+ * одного размера: блоки нарезаются из больших кусков памяти и после
+ * освобождения попадают в список свободных, откуда переиспользуются без
+ * обращения к malloc. Каждый поток держит собственный список свободных
+ * блоков и обменивается с общим пулом, защищенным мьютексом, пачками по
+ * kBatch блоков, поэтому в установившемся режиме push/pop списка не
+ * берет блокировок. Блок, выделенный в одном потоке, можно освободить в
+ * другом.
+ *
+ * Пул общий для всех типов одного размера и выравнивания и живет до
+ * завершения программы: куски памяти системе не возвращаются. Запросы
+ * n > 1 передаются в operator new.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_LIST_S21_NODE_POOL_ALLOCATOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_LIST_S21_NODE_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+namespace node_pool_detail {
+
+/**
+ * @brief Пул блоков размера Size с выравниванием Align.
+ *
+ * Общий список свободных блоков защищен мьютексом; у каждого потока свой
+ * кэш, который пополняется и сбрасывается пачками.
+ */
+template <std::size_t Size, std::size_t Align>
+class Pool {
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  static_assert(Align <= alignof(std::max_align_t),
+                "node_pool_allocator: over-aligned types are not supported");
+
+ public:
+  /// Размер блока: помещает и объект, и указатель списка свободных.
+  static constexpr std::size_t kBlockSize =
+      ((Size > sizeof(FreeBlock) ? Size : sizeof(FreeBlock)) +
+       alignof(std::max_align_t) - 1) /
+      alignof(std::max_align_t) * alignof(std::max_align_t);
+  /// Сколько блоков поток берет из общего пула за раз.
+  static constexpr std::size_t kBatch = 64;
+  /// Размер куска памяти, из которого нарезаются блоки.
+  static constexpr std::size_t kChunkBytes =
+      kBlockSize * kBatch > 64 * 1024 ? kBlockSize * kBatch : 64 * 1024;
+
+  static void *allocate() {
+    Cache &cache = localCache();
+    if (cache.head == nullptr) shared().refill(cache);
+    FreeBlock *block = cache.head;
+    cache.head = block->next;
+    --cache.count;
+    return block;
+  }
+
+  static void deallocate(void *p) noexcept {
+    FreeBlock *block = static_cast<FreeBlock *>(p);
+    Cache &cache = localCache();
+    if (cache.dead) {
+      // Кэш потока уже сброшен (освобождение при завершении потока)
+      shared().put(block, block);
+      return;
+    }
+    block->next = cache.head;
+    cache.head = block;
+    if (++cache.count >= 2 * kBatch) shared().drain(cache, kBatch);
+  }
+
+  /// Сколько кусков памяти выделено под этот размер блока.
+  static std::size_t chunk_count() {
+    Shared &pool = shared();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.chunks;
+  }
+
+ private:
+  // Тривиальный тип без деструктора: остается доступным и после того, как
+  // Flusher потока отработал
+  struct Cache {
+    FreeBlock *head;
+    std::size_t count;
+    bool registered;
+    bool dead;
+  };
+
+  // Возвращает кэш потока в общий пул при завершении потока
+  struct Flusher {
+    ~Flusher() {
+      Cache &cache = cache_;
+      shared().drain(cache, cache.count);
+      cache.dead = true;
+    }
+  };
+
+  struct Shared {
+    std::mutex mutex;
+    FreeBlock *head = nullptr;
+    FreeBlock *last_chunk = nullptr;
+    std::size_t chunks = 0;
+
+    void put(FreeBlock *first, FreeBlock *last) {
+      std::lock_guard<std::mutex> lock(mutex);
+      last->next = head;
+      head = first;
+    }
+
+    /// Передает кэшу до kBatch блоков, при нехватке нарезает новый кусок.
+    void refill(Cache &cache) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (head == nullptr) carve();
+      FreeBlock *first = head;
+      FreeBlock *last = head;
+      std::size_t taken = 1;
+      for (; taken < kBatch && last->next != nullptr; ++taken) {
+        last = last->next;
+      }
+      head = last->next;
+      last->next = cache.head;
+      cache.head = first;
+      cache.count += taken;
+    }
+
+    /// Возвращает count блоков из начала кэша в общий список.
+    void drain(Cache &cache, std::size_t count) {
+      if (count == 0) return;
+      FreeBlock *first = cache.head;
+      FreeBlock *last = first;
+      for (std::size_t i = 1; i < count; ++i) last = last->next;
+      cache.head = last->next;
+      cache.count -= count;
+      put(first, last);
+    }
+
+    /// Нарезает новый кусок; первый блок хранит ссылку на предыдущий кусок,
+    /// чтобы все куски оставались достижимыми.
+    void carve() {
+      char *chunk = static_cast<char *>(::operator new(kChunkBytes));
+      reinterpret_cast<FreeBlock *>(chunk)->next = last_chunk;
+      last_chunk = reinterpret_cast<FreeBlock *>(chunk);
+      ++chunks;
+      std::size_t blocks = kChunkBytes / kBlockSize;
+      for (std::size_t i = blocks; i-- > 1;) {
+        auto *block = reinterpret_cast<FreeBlock *>(chunk + i * kBlockSize);
+        block->next = head;
+        head = block;
+      }
+    }
+  };
+
+  static inline thread_local Cache cache_{};
+
+  static Cache &localCache() {
+    Cache &cache = cache_;
+    if (!cache.registered) {
+      cache.registered = true;
+      static thread_local Flusher flusher;
+      (void)flusher;
+    }
+    return cache;
+  }
+
+  /// Общий пул не разрушается: узлы статических списков могут
+  /// освобождаться после завершения main.
+  static Shared &shared() {
+    static Shared *pool = new Shared();
+    return *pool;
+  }
+};
+
+}  // namespace node_pool_detail
+
+/**
+ * @brief Аллокатор одиночных объектов из общего пула блоков.
+ *
+ * Экземпляры не имеют состояния и все равны между собой, поэтому списки
+ * с этим аллокатором обмениваются узлами через splice и swap без
+ * ограничений.
+ *
+ * @tparam T Тип объектов.
+ */
+template <typename T>
+class node_pool_allocator {
+  using Pool = node_pool_detail::Pool<sizeof(T), alignof(T)>;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using is_always_equal = std::true_type;
+
+  node_pool_allocator() noexcept = default;
+
+  template <typename U>
+  node_pool_allocator(const node_pool_allocator<U> &) noexcept {}
+
+  T *allocate(size_type n) {
+    if (n == 1) return static_cast<T *>(Pool::allocate());
+    if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    if (n == 1) {
+      Pool::deallocate(p);
+    } else {
+      ::operator delete(p);
+    }
+  }
+
+  /// Сколько кусков памяти пул выделил под объекты размера sizeof(T).
+  static size_type chunk_count() { return Pool::chunk_count(); }
+
+  template <typename U>
+  bool operator==(const node_pool_allocator<U> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const node_pool_allocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_LIST_S21_NODE_POOL_ALLOCATOR_H_
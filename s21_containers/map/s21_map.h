@@ -18,6 +18,7 @@
 #include <functional>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 #include "s21_map_iterator.h"
 
@@ -35,6 +36,8 @@ class map {
   using PairCompareType = PairCompare<Key, Value, Compare>;
   using iterator = MapIterator<Key, Value, Compare>;
   using const_iterator = ConstMapIterator<Key, Value, Compare>;
+  using insert_range_stats =
+      typename RedBlackTree<KeyValuePair, PairCompareType>::InsertRangeStats;
 
   map() = default;
   map(std::initializer_list<value_type> const &items) {
@@ -78,6 +81,14 @@ class map {
     return insert({key, obj});
   }
   
+  // Пакетная вставка: диапазон сортируется (если нужно) и сливается с деревом
+  // за один проход, каждый спуск начинается от места предыдущей вставки.
+  // При повторах ключа сохраняется первое значение, как и у insert().
+  template <typename InputIt>
+  insert_range_stats insert_range(InputIt first, InputIt last) {
+    return tree.insert_range(first, last);
+  }
+
   // Заменяет значение по ключу 
   std::pair<iterator, bool> insert_or_assign(const Key &key, const Value &obj) {
     auto result = tree.insert({key, obj});
@@ -131,6 +142,24 @@ class map {
     return tree.find(kv) != nullptr;
   }
 
+  // Пакетный поиск: спуски по дереву чередуются, промахи кэша перекрываются.
+  // Для отсутствующих ключей возвращается end().
+  std::vector<iterator> find_many(const std::vector<Key> &keys,
+                                  size_type group_size = 16) {
+    std::vector<KeyValuePair> probes;
+    probes.reserve(keys.size());
+    for (const auto &key : keys) {
+      probes.push_back({key, {}});
+    }
+    auto nodes = tree.find_many(probes, group_size);
+    std::vector<iterator> results;
+    results.reserve(nodes.size());
+    for (const auto &node : nodes) {
+      results.push_back(node ? iterator(node) : end());
+    }
+    return results;
+  }
+
   template <typename... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
     std::vector<std::pair<iterator, bool>> results = {
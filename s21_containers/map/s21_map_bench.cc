@@ -0,0 +1,84 @@
+// Бенчмарк большого map: обычный спуск против find_many с предвыборкой для
+// групп размером 1, 8 и 32, поэлементная вставка против insert_range.
+//
+// Запуск: ./bench.out [количество элементов] [количество поисков]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "s21_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+  std::size_t lookups =
+      argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1 << 20;
+
+  std::mt19937_64 rng(42);
+  s21::map<long, long> map;
+  std::vector<long> inserted;
+  inserted.reserve(size);
+  while (map.size() < size) {
+    long key = static_cast<long>(rng() >> 1);
+    if (map.insert(key, key).second) inserted.push_back(key);
+  }
+  std::vector<long> keys(lookups);
+  for (auto &key : keys) {
+    key = inserted[rng() % inserted.size()];
+  }
+
+  std::printf("map lookups, %zu entries, %zu keys\n", size, lookups);
+
+  auto start = Clock::now();
+  std::size_t found = 0;
+  for (long key : keys) {
+    found += map.contains(key);
+  }
+  double elapsed = Seconds(start);
+  std::printf("  %-22s %12.0f lookups/s (found %zu)\n", "contains",
+              lookups / elapsed, found);
+
+  for (std::size_t group : {1, 8, 32}) {
+    start = Clock::now();
+    auto results = map.find_many(keys, group);
+    elapsed = Seconds(start);
+    found = 0;
+    for (auto &it : results) {
+      found += it != map.end();
+    }
+    std::printf("  find_many group=%-6zu %12.0f lookups/s (found %zu)\n",
+                group, lookups / elapsed, found);
+  }
+
+  std::vector<std::pair<const long, long>> batch;
+  for (long key = 0; key < static_cast<long>(lookups); ++key) {
+    batch.push_back({key * 3, key});
+  }
+  std::printf("map inserts, %zu sorted keys\n", batch.size());
+  s21::map<long, long> one_by_one;
+  start = Clock::now();
+  for (const auto &item : batch) {
+    one_by_one.insert(item);
+  }
+  elapsed = Seconds(start);
+  std::printf("  %-22s %12.0f inserts/s\n", "insert", batch.size() / elapsed);
+  s21::map<long, long> ranged;
+  start = Clock::now();
+  ranged.insert_range(batch.begin(), batch.end());
+  elapsed = Seconds(start);
+  std::printf("  %-22s %12.0f inserts/s\n", "insert_range",
+              batch.size() / elapsed);
+  return 0;
+}
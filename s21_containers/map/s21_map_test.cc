@@ -509,4 +509,32 @@ TEST(ConstMapIteratorTest, NotEqualOperatorTest) {
   // Проверка, что итераторы, указывающие на один и тот же элемент, не различны
   ++it1;
   EXPECT_FALSE(it1 != it2);
-}
\ No newline at end of file
+}
+
+TEST(MapTest, FindManyTest) {
+  s21::map<int, std::string> test_map{{1, "one"}, {3, "three"}, {5, "five"}};
+
+  auto results = test_map.find_many({5, 2, 1, 6, 3}, 2);
+
+  ASSERT_EQ(results.size(), 5U);
+  EXPECT_EQ((*results[0]).second, "five");
+  EXPECT_TRUE(results[1] == test_map.end());
+  EXPECT_EQ((*results[2]).second, "one");
+  EXPECT_TRUE(results[3] == test_map.end());
+  EXPECT_EQ((*results[4]).second, "three");
+}
+
+TEST(MapTest, InsertRangeKeepsFirstValue) {
+  s21::map<int, std::string> test_map{{2, "two"}};
+  std::vector<std::pair<const int, std::string>> batch{
+      {3, "three"}, {1, "one"}, {2, "dup"}, {3, "dup"}};
+
+  auto stats = test_map.insert_range(batch.begin(), batch.end());
+
+  EXPECT_EQ(stats.inserted, 2U);
+  EXPECT_EQ(stats.existing, 2U);
+  EXPECT_EQ(test_map.size(), 3U);
+  EXPECT_EQ(test_map.at(1), "one");
+  EXPECT_EQ(test_map.at(2), "two");
+  EXPECT_EQ(test_map.at(3), "three");
+}
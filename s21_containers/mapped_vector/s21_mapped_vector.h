@@ -0,0 +1,381 @@
+/**
+ * @file s21_mapped_vector.h
+ * @brief Вектор, хранящий элементы в отображенном в память файле.
+ *
+ * Класс mapped_vector дает тот же доступ по индексу и итераторам, что и
+ * s21::vector, но буфер - это файл, отображенный через mmap (MAP_SHARED).
+ * Изменения попадают в файл без отдельной сериализации, а при повторном
+ * открытии данные становятся доступны сразу после mmap, без разбора:
+ * страницы подгружаются ядром по мере обращения.
+ *
+ * Формат файла: заголовок FileHeader (64 байта, сигнатура, версия, размер
+ * элемента и количество элементов), за ним элементы подряд. Емкость вектора
+ * определяется размером файла; при росте файл увеличивается через ftruncate
+ * и отображение расширяется (mremap в Linux, повторный mmap в остальных
+ * системах).
+ *
+ * Подходит только для тривиально копируемых типов без указателей: файл
+ * может быть открыт другим процессом по другому адресу.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_MAPPED_VECTOR_S21_MAPPED_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_MAPPED_VECTOR_S21_MAPPED_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/// Режим открытия файла mapped_vector.
+enum class open_mode {
+  create,     ///< Создать пустой файл (существующий перезаписывается).
+  read_only,  ///< Открыть существующий файл только для чтения.
+  read_write  ///< Открыть существующий файл для чтения и записи.
+};
+
+/**
+ * @class mapped_vector
+ * @brief Динамический массив тривиально копируемых элементов в файле.
+ *
+ * Количество элементов хранится в заголовке файла и обновляется при каждом
+ * изменении. Для гарантии записи на диск нужно вызвать sync(). В режиме
+ * read_only изменять элементы нельзя: методы, меняющие размер, бросают
+ * std::logic_error, а запись через ссылку завершится ошибкой доступа.
+ *
+ * Ошибки системных вызовов передаются исключением std::system_error,
+ * неверный формат файла - std::runtime_error.
+ *
+ * @tparam T Тип элементов.
+ */
+template <typename T>
+class mapped_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mapped_vector stores elements as raw bytes");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  /// Размер заголовка файла в байтах; элементы начинаются с этого смещения.
+  static constexpr size_type kHeaderSize = 64;
+
+  mapped_vector() = default;
+
+  mapped_vector(const std::string &path, open_mode mode) { open(path, mode); }
+
+  mapped_vector(const mapped_vector &) = delete;
+  mapped_vector &operator=(const mapped_vector &) = delete;
+
+  mapped_vector(mapped_vector &&other) noexcept { swap(other); }
+
+  mapped_vector &operator=(mapped_vector &&other) noexcept {
+    if (this != &other) {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~mapped_vector() { close(); }
+
+  /**
+   * @brief Открывает или создает файл и отображает его в память.
+   *
+   * Открытый ранее файл закрывается.
+   */
+  void open(const std::string &path, open_mode mode) {
+    close();
+    writable_ = mode != open_mode::read_only;
+    int flags = writable_ ? O_RDWR : O_RDONLY;
+    if (mode == open_mode::create) flags |= O_CREAT | O_TRUNC;
+    fd_ = ::open(path.c_str(), flags, 0644);
+    if (fd_ < 0) throwErrno("open " + path);
+    try {
+      if (mode == open_mode::create) {
+        if (ftruncate(fd_, static_cast<off_t>(kHeaderSize)) != 0) {
+          throwErrno("ftruncate " + path);
+        }
+        mapFile(kHeaderSize);
+        std::memcpy(header()->magic, kMagic, sizeof(kMagic));
+        header()->version = kVersion;
+        header()->element_size = sizeof(value_type);
+        header()->size = 0;
+      } else {
+        struct stat info;
+        if (fstat(fd_, &info) != 0) throwErrno("fstat " + path);
+        size_type file_size = static_cast<size_type>(info.st_size);
+        if (file_size < kHeaderSize) {
+          throw std::runtime_error("mapped_vector: " + path +
+                                   " is too short for a header");
+        }
+        mapFile(file_size);
+        checkHeader(path);
+      }
+    } catch (...) {
+      close();
+      throw;
+    }
+  }
+
+  /// Снимает отображение и закрывает файл. Данные остаются в файле.
+  void close() noexcept {
+    if (base_ != nullptr) munmap(base_, mapped_bytes_);
+    if (fd_ >= 0) ::close(fd_);
+    base_ = nullptr;
+    mapped_bytes_ = 0;
+    fd_ = -1;
+  }
+
+  bool is_open() const { return base_ != nullptr; }
+  bool writable() const { return writable_; }
+
+  /// Синхронно записывает измененные страницы на диск (msync).
+  void sync() {
+    if (base_ != nullptr && writable_ &&
+        msync(base_, mapped_bytes_, MS_SYNC) != 0) {
+      throwErrno("msync");
+    }
+  }
+
+  reference at(size_type pos) {
+    checkIndex(pos);
+    return data()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    checkIndex(pos);
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) { return data()[pos]; }
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+  reference front() { return data()[0]; }
+  const_reference front() const { return data()[0]; }
+  reference back() { return data()[size() - 1]; }
+  const_reference back() const { return data()[size() - 1]; }
+
+  value_type *data() {
+    return reinterpret_cast<value_type *>(base_ + kHeaderSize);
+  }
+  const value_type *data() const {
+    return reinterpret_cast<const value_type *>(base_ + kHeaderSize);
+  }
+
+  iterator begin() { return data(); }
+  iterator end() { return data() + size(); }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data() + size(); }
+  const_iterator cbegin() const { return data(); }
+  const_iterator cend() const { return data() + size(); }
+
+  bool empty() const { return size() == 0; }
+  size_type size() const {
+    return base_ == nullptr ? 0 : static_cast<size_type>(header()->size);
+  }
+  size_type capacity() const {
+    if (base_ == nullptr) return 0;
+    return (mapped_bytes_ - kHeaderSize) / sizeof(value_type);
+  }
+  size_type max_size() const {
+    return (std::numeric_limits<size_type>::max() - kHeaderSize) /
+           sizeof(value_type);
+  }
+
+  /// Увеличивает файл до емкости new_capacity элементов.
+  void reserve(size_type new_capacity) {
+    checkWritable();
+    if (new_capacity > capacity()) remap(new_capacity);
+  }
+
+  /// Укорачивает файл до текущего количества элементов.
+  void shrink_to_fit() {
+    checkWritable();
+    if (size() < capacity()) remap(size());
+  }
+
+  void clear() {
+    checkWritable();
+    setSize(0);
+  }
+
+  /// Новые элементы инициализируются значением value_type{}.
+  void resize(size_type n) {
+    checkWritable();
+    if (n > capacity()) remap(std::max(n, capacity() * 2));
+    std::fill(data() + size(), data() + std::max(n, size()), value_type{});
+    setSize(n);
+  }
+
+  void push_back(const_reference value) {
+    value_type copy = value;  // value может лежать в переносимом буфере
+    reserveForOneMore();
+    data()[size()] = copy;
+    setSize(size() + 1);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    push_back(value_type{std::forward<Args>(args)...});
+    return back();
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    reserve(size() + sizeof...(Args));
+    (push_back(std::forward<Args>(args)), ...);
+  }
+
+  void pop_back() {
+    checkWritable();
+    setSize(size() - 1);
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    size_type index = static_cast<size_type>(pos - data());
+    value_type copy = value;
+    reserveForOneMore();
+    value_type *first = data() + index;
+    std::memmove(static_cast<void *>(first + 1), first,
+                 (size() - index) * sizeof(value_type));
+    *first = copy;
+    setSize(size() + 1);
+    return first;
+  }
+
+  void erase(iterator pos) {
+    checkWritable();
+    std::memmove(static_cast<void *>(pos), pos + 1,
+                 static_cast<size_type>(end() - pos - 1) * sizeof(value_type));
+    setSize(size() - 1);
+  }
+
+  void swap(mapped_vector &other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(base_, other.base_);
+    std::swap(mapped_bytes_, other.mapped_bytes_);
+    std::swap(writable_, other.writable_);
+  }
+
+ private:
+  static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'V', 'E', 'C', 0};
+  static constexpr std::uint32_t kVersion = 1;
+
+  struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t size;
+  };
+  static_assert(sizeof(FileHeader) <= kHeaderSize);
+  static_assert(alignof(T) <= kHeaderSize,
+                "elements must stay aligned after the header");
+
+  int fd_ = -1;
+  unsigned char *base_ = nullptr;
+  size_type mapped_bytes_ = 0;
+  bool writable_ = false;
+
+  [[noreturn]] static void throwErrno(const std::string &what) {
+    throw std::system_error(errno, std::generic_category(),
+                            "mapped_vector: " + what);
+  }
+
+  FileHeader *header() { return reinterpret_cast<FileHeader *>(base_); }
+  const FileHeader *header() const {
+    return reinterpret_cast<const FileHeader *>(base_);
+  }
+
+  void setSize(size_type n) { header()->size = n; }
+
+  void checkIndex(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("mapped_vector::at: index " +
+                              std::to_string(pos) + " >= size " +
+                              std::to_string(size()));
+    }
+  }
+
+  void checkWritable() const {
+    if (!writable_ || base_ == nullptr) {
+      throw std::logic_error("mapped_vector: not open for writing");
+    }
+  }
+
+  void checkHeader(const std::string &path) const {
+    const FileHeader *h = header();
+    if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0 ||
+        h->version != kVersion) {
+      throw std::runtime_error("mapped_vector: " + path +
+                               " is not a mapped_vector file");
+    }
+    if (h->element_size != sizeof(value_type)) {
+      throw std::runtime_error("mapped_vector: " + path +
+                               " holds elements of " +
+                               std::to_string(h->element_size) + " bytes");
+    }
+    if (h->size > capacity()) {
+      throw std::runtime_error("mapped_vector: " + path + " is truncated");
+    }
+  }
+
+  void mapFile(size_type bytes) {
+    int protection = writable_ ? PROT_READ | PROT_WRITE : PROT_READ;
+    void *p = mmap(nullptr, bytes, protection, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) throwErrno("mmap");
+    base_ = static_cast<unsigned char *>(p);
+    mapped_bytes_ = bytes;
+  }
+
+  void reserveForOneMore() {
+    checkWritable();
+    if (size() == capacity()) remap(std::max<size_type>(1, capacity() * 2));
+  }
+
+  /// Меняет размер файла под new_capacity элементов и отображение вслед.
+  void remap(size_type new_capacity) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("mapped_vector: capacity is too large");
+    }
+    size_type bytes = kHeaderSize + new_capacity * sizeof(value_type);
+    if (ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+      throwErrno("ftruncate");
+    }
+#ifdef MREMAP_MAYMOVE
+    void *p = mremap(base_, mapped_bytes_, bytes, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) throwErrno("mremap");
+    base_ = static_cast<unsigned char *>(p);
+    mapped_bytes_ = bytes;
+#else
+    // Старое отображение снимается только после успешного mmap: при отказе
+    // вектор остается открытым с прежними данными
+    unsigned char *old_base = base_;
+    size_type old_bytes = mapped_bytes_;
+    mapFile(bytes);
+    munmap(old_base, old_bytes);
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_MAPPED_VECTOR_S21_MAPPED_VECTOR_H_
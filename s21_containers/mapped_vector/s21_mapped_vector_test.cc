@@ -0,0 +1,101 @@
+#include "s21_mapped_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+namespace {
+
+struct Record {
+  std::uint64_t id;
+  double value;
+};
+
+// Путь к временному файлу, удаляемому по окончании теста
+class TempFile {
+ public:
+  explicit TempFile(const std::string &name)
+      : path_((std::filesystem::temp_directory_path() / name).string()) {
+    std::filesystem::remove(path_);
+  }
+  ~TempFile() { std::filesystem::remove(path_); }
+  const std::string &path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+}  // namespace
+
+TEST(mapped_vector, persists_between_opens) {
+  TempFile file("s21_mapped_vector_persist.bin");
+  {
+    s21::mapped_vector<Record> vector(file.path(), s21::open_mode::create);
+    EXPECT_TRUE(vector.empty());
+    for (std::uint64_t i = 0; i < 10000; ++i) {
+      vector.push_back({i, static_cast<double>(i) / 2});
+    }
+    vector.sync();
+  }
+  s21::mapped_vector<Record> reader(file.path(), s21::open_mode::read_only);
+  ASSERT_EQ(reader.size(), 10000UL);
+  EXPECT_EQ(reader[1234].id, 1234U);
+  EXPECT_DOUBLE_EQ(reader.back().value, 4999.5);
+  std::uint64_t sum = 0;
+  for (const Record &record : reader) {
+    sum += record.id;
+  }
+  EXPECT_EQ(sum, 10000U * 9999U / 2);
+  EXPECT_THROW(reader.push_back({0, 0}), std::logic_error);
+  EXPECT_THROW(reader.at(10000), std::out_of_range);
+}
+
+TEST(mapped_vector, read_write_grows_file) {
+  TempFile file("s21_mapped_vector_grow.bin");
+  {
+    s21::mapped_vector<int> vector(file.path(), s21::open_mode::create);
+    vector.insert_many_back(1, 2, 3);
+  }
+  s21::mapped_vector<int> vector(file.path(), s21::open_mode::read_write);
+  ASSERT_EQ(vector.size(), 3UL);
+  vector.reserve(1 << 20);
+  EXPECT_EQ(std::filesystem::file_size(file.path()),
+            s21::mapped_vector<int>::kHeaderSize + (1 << 20) * sizeof(int));
+  vector.insert(vector.cbegin() + 1, 10);
+  vector.erase(vector.begin());
+  vector.resize(6);
+  int expected[] = {10, 2, 3, 0, 0, 0};
+  EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected));
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.capacity(), 6UL);
+  EXPECT_EQ(std::filesystem::file_size(file.path()),
+            s21::mapped_vector<int>::kHeaderSize + 6 * sizeof(int));
+
+  s21::mapped_vector<int> moved(std::move(vector));
+  EXPECT_FALSE(vector.is_open());
+  EXPECT_EQ(moved[0], 10);
+}
+
+TEST(mapped_vector, rejects_foreign_files) {
+  TempFile file("s21_mapped_vector_bad.bin");
+  EXPECT_THROW(s21::mapped_vector<int>(file.path(), s21::open_mode::read_only),
+               std::system_error);
+  {
+    s21::mapped_vector<int> vector(file.path(), s21::open_mode::create);
+    vector.push_back(1);
+  }
+  // Файл с другим размером элемента
+  EXPECT_THROW(
+      s21::mapped_vector<Record>(file.path(), s21::open_mode::read_only),
+      std::runtime_error);
+  {
+    std::ofstream out(file.path(), std::ios::binary | std::ios::trunc);
+    out << std::string(100, 'x');
+  }
+  EXPECT_THROW(s21::mapped_vector<int>(file.path(), s21::open_mode::read_write),
+               std::runtime_error);
+}
@@ -0,0 +1,399 @@
+/**
+ * @file s21_parallel_sort.h
+ * @brief Параллельные сортировки и разбиение для непрерывных диапазонов
+ * (s21::vector, s21::array, std::vector).
+ *
+ * - parallel_sort и parallel_stable_sort делят диапазон на куски по числу
+ *   потоков, сортируют их параллельно (std::sort и std::stable_sort) и
+ *   попарно сливают через вспомогательный буфер. Каждое слияние тоже
+ *   делится на независимые части бинарным поиском, так что последнее
+ *   слияние не выполняется одним потоком. Слияние устойчиво.
+ * - radix_sort - поразрядная LSD-сортировка целочисленных ключей по байтам:
+ *   на каждом проходе потоки считают гистограммы своих блоков, затем
+ *   раскладывают элементы по вычисленным смещениям. Проходы, в которых у
+ *   всех ключей одинаковый байт, пропускаются. Сортировка устойчива.
+ * - parallel_partition - устойчивое разбиение по предикату за два прохода.
+ *
+ * Все функции принимают пул потоков (thread_pool), по умолчанию -
+ * default_thread_pool(). Маленькие диапазоны сортируются в вызывающем
+ * потоке. Буфер занимает столько же памяти, сколько сам диапазон.
+ *
+ * Пример:
+ * @code
+ * s21::thread_pool pool(8);
+ * s21::parallel_sort(v.begin(), v.end(), std::less<>(), pool);
+ * s21::radix_sort(records.begin(), records.end(),
+ *                 [](const Record &r) { return r.id; }, pool);
+ * @endcode
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_PARALLEL_S21_PARALLEL_SORT_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_PARALLEL_S21_PARALLEL_SORT_H_
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+namespace s21 {
+namespace parallel_detail {
+
+/// Меньше этого числа элементов диапазон обрабатывается одним потоком.
+inline constexpr std::ptrdiff_t kSequentialCutoff = 1 << 14;
+/// Слияния меньше этого размера не делятся на части.
+inline constexpr std::ptrdiff_t kMergeGrain = 1 << 15;
+
+/**
+ * @brief Неинициализированный буфер на n элементов. Элементы создаются
+ * вызывающим кодом; construct_all() отмечает, что буфер заполнен и
+ * элементы нужно уничтожить.
+ */
+template <typename T>
+class TempBuffer {
+ public:
+  explicit TempBuffer(std::size_t n)
+      : data_(std::allocator<T>().allocate(n)), size_(n) {}
+
+  TempBuffer(const TempBuffer &) = delete;
+  TempBuffer &operator=(const TempBuffer &) = delete;
+
+  ~TempBuffer() {
+    if (constructed_) std::destroy(data_, data_ + size_);
+    std::allocator<T>().deallocate(data_, size_);
+  }
+
+  T *data() { return data_; }
+  void construct_all() { constructed_ = true; }
+
+ private:
+  T *data_;
+  std::size_t size_;
+  bool constructed_ = false;
+};
+
+/// Границы i-го из parts равных кусков диапазона длины n.
+inline std::ptrdiff_t bound(std::ptrdiff_t n, std::size_t parts,
+                            std::size_t i) {
+  return static_cast<std::ptrdiff_t>(static_cast<std::size_t>(n) * i / parts);
+}
+
+/**
+ * @brief Выполняет fn(part, begin, end) для parts кусков [0, n)
+ * параллельно; нулевой кусок - в вызывающем потоке.
+ */
+template <typename Fn>
+void forEachPart(thread_pool &pool, std::ptrdiff_t n, std::size_t parts,
+                 Fn fn) {
+  task_group group(pool);
+  for (std::size_t i = 1; i < parts; ++i) {
+    group.run([=, &fn] {
+      fn(i, bound(n, parts, i), bound(n, parts, i + 1));
+    });
+  }
+  fn(0, 0, bound(n, parts, 1));
+  group.wait();
+}
+
+/// Сколько кусков делать при threads потоках: степень двойки не меньше.
+inline std::size_t partCount(const thread_pool &pool) {
+  std::size_t parts = 1;
+  while (parts < pool.thread_count()) parts *= 2;
+  return parts;
+}
+
+/**
+ * @brief Устойчиво сливает [first1, last1) и [first2, last2) в out
+ * перемещением, отдавая части больших слияний в группу.
+ *
+ * Больший диапазон делится пополам, точка деления в другом находится
+ * бинарным поиском так, чтобы равные элементы первого диапазона остались
+ * перед равными элементами второго.
+ */
+template <typename It, typename Out, typename Compare>
+void parallelMerge(task_group &group, It first1, It last1, It first2,
+                   It last2, Out out, Compare comp) {
+  while ((last1 - first1) + (last2 - first2) > kMergeGrain) {
+    It middle1, middle2;
+    if (last1 - first1 >= last2 - first2) {
+      middle1 = first1 + (last1 - first1) / 2;
+      middle2 = std::lower_bound(first2, last2, *middle1, comp);
+    } else {
+      middle2 = first2 + (last2 - first2) / 2;
+      middle1 = std::upper_bound(first1, last1, *middle2, comp);
+    }
+    Out out_right = out + (middle1 - first1) + (middle2 - first2);
+    group.run([=, &group] {
+      parallelMerge(group, middle1, last1, middle2, last2, out_right, comp);
+    });
+    last1 = middle1;
+    last2 = middle2;
+  }
+  std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+             std::make_move_iterator(first2), std::make_move_iterator(last2),
+             out, comp);
+}
+
+/**
+ * @brief Общая схема parallel_sort и parallel_stable_sort: куски
+ * сортируются функцией leaf, затем сливаются раундами через буфер.
+ */
+template <typename RandomIt, typename Compare, typename LeafSort>
+void mergeSort(RandomIt first, RandomIt last, Compare comp, thread_pool &pool,
+               LeafSort leaf) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  std::ptrdiff_t n = last - first;
+  std::size_t parts = partCount(pool);
+  if (n < kSequentialCutoff || parts == 1) {
+    leaf(first, last, comp);
+    return;
+  }
+  forEachPart(pool, n, parts,
+              [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+                leaf(first + begin, first + end, comp);
+              });
+
+  TempBuffer<T> buffer(static_cast<std::size_t>(n));
+  T *buf = buffer.data();
+  forEachPart(pool, n, parts,
+              [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+                std::uninitialized_move(first + begin, first + end,
+                                        buf + begin);
+              });
+  buffer.construct_all();
+
+  // Раунд сливает пары соседних отсортированных кусков ширины width
+  bool in_buffer = true;
+  for (std::size_t width = 1; width < parts; width *= 2) {
+    task_group group(pool);
+    for (std::size_t i = 0; i < parts; i += 2 * width) {
+      std::ptrdiff_t low = bound(n, parts, i);
+      std::ptrdiff_t middle = bound(n, parts, i + width);
+      std::ptrdiff_t high = bound(n, parts, i + 2 * width);
+      if (in_buffer) {
+        group.run([=, &group] {
+          parallelMerge(group, buf + low, buf + middle, buf + middle,
+                        buf + high, first + low, comp);
+        });
+      } else {
+        group.run([=, &group] {
+          parallelMerge(group, first + low, first + middle, first + middle,
+                        first + high, buf + low, comp);
+        });
+      }
+    }
+    group.wait();
+    in_buffer = !in_buffer;
+  }
+  if (in_buffer) {
+    forEachPart(pool, n, parts,
+                [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+                  std::move(buf + begin, buf + end, first + begin);
+                });
+  }
+}
+
+struct Identity {
+  template <typename T>
+  const T &operator()(const T &value) const {
+    return value;
+  }
+};
+
+}  // namespace parallel_detail
+
+/// Параллельная сортировка [first, last) по comp (неустойчивая).
+template <typename RandomIt, typename Compare = std::less<>>
+void parallel_sort(RandomIt first, RandomIt last, Compare comp = Compare(),
+                   thread_pool &pool = default_thread_pool()) {
+  parallel_detail::mergeSort(first, last, comp, pool,
+                             [](RandomIt begin, RandomIt end, Compare &c) {
+                               std::sort(begin, end, c);
+                             });
+}
+
+/// Параллельная устойчивая сортировка [first, last) по comp.
+template <typename RandomIt, typename Compare = std::less<>>
+void parallel_stable_sort(RandomIt first, RandomIt last,
+                          Compare comp = Compare(),
+                          thread_pool &pool = default_thread_pool()) {
+  parallel_detail::mergeSort(first, last, comp, pool,
+                             [](RandomIt begin, RandomIt end, Compare &c) {
+                               std::stable_sort(begin, end, c);
+                             });
+}
+
+/**
+ * @brief Устойчивая поразрядная сортировка по возрастанию целочисленного
+ * ключа key(element).
+ *
+ * Знаковые ключи сортируются с учетом знака. Элементы должны быть
+ * перемещаемыми; ключ вычисляется на каждом проходе, поэтому должен быть
+ * дешевым.
+ */
+template <typename RandomIt, typename Key = parallel_detail::Identity>
+void radix_sort(RandomIt first, RandomIt last, Key key = Key(),
+                thread_pool &pool = default_thread_pool()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  using K = std::decay_t<std::invoke_result_t<Key &, const T &>>;
+  static_assert(std::is_integral_v<K>, "radix_sort needs an integral key");
+  using U = std::make_unsigned_t<K>;
+  constexpr U kSignFlip =
+      std::is_signed_v<K> ? U(U(1) << (sizeof(U) * CHAR_BIT - 1)) : U(0);
+  constexpr std::size_t kBuckets = 256;
+  using Histogram = std::array<std::size_t, kBuckets>;
+
+  std::ptrdiff_t n = last - first;
+  if (n < 2) return;
+  std::size_t parts = n < parallel_detail::kSequentialCutoff
+                          ? 1
+                          : std::max<std::size_t>(pool.thread_count(), 1);
+
+  parallel_detail::TempBuffer<T> buffer(static_cast<std::size_t>(n));
+  T *buf = buffer.data();
+  parallel_detail::forEachPart(
+      pool, n, parts,
+      [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+        std::uninitialized_move(first + begin, first + end, buf + begin);
+      });
+  buffer.construct_all();
+
+  auto digit = [&key](const T &value, unsigned shift) {
+    U bits = static_cast<U>(static_cast<U>(key(value)) ^ kSignFlip);
+    return static_cast<std::size_t>((bits >> shift) & (kBuckets - 1));
+  };
+
+  // Проход по байту shift из src в dst; false, если у всех ключей байт
+  // одинаковый и переставлять нечего
+  std::vector<Histogram> counts(parts);
+  auto pass = [&](auto src, auto dst, unsigned shift) {
+    parallel_detail::forEachPart(
+        pool, n, parts,
+        [&](std::size_t part, std::ptrdiff_t begin, std::ptrdiff_t end) {
+          Histogram &count = counts[part];
+          count.fill(0);
+          for (std::ptrdiff_t i = begin; i < end; ++i) {
+            ++count[digit(src[i], shift)];
+          }
+        });
+    std::size_t offset = 0;
+    for (std::size_t d = 0; d < kBuckets; ++d) {
+      std::size_t bucket = offset;
+      for (Histogram &count : counts) {
+        std::size_t size = count[d];
+        count[d] = offset;
+        offset += size;
+      }
+      if (offset - bucket == static_cast<std::size_t>(n)) return false;
+    }
+    parallel_detail::forEachPart(
+        pool, n, parts,
+        [&](std::size_t part, std::ptrdiff_t begin, std::ptrdiff_t end) {
+          Histogram &next = counts[part];
+          for (std::ptrdiff_t i = begin; i < end; ++i) {
+            std::size_t d = digit(src[i], shift);
+            dst[static_cast<std::ptrdiff_t>(next[d]++)] = std::move(src[i]);
+          }
+        });
+    return true;
+  };
+
+  bool in_buffer = true;
+  for (unsigned shift = 0; shift < sizeof(U) * CHAR_BIT; shift += 8) {
+    if (in_buffer ? pass(buf, first, shift) : pass(first, buf, shift)) {
+      in_buffer = !in_buffer;
+    }
+  }
+  if (in_buffer) {
+    parallel_detail::forEachPart(
+        pool, n, parts,
+        [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+          std::move(buf + begin, buf + end, first + begin);
+        });
+  }
+}
+
+/**
+ * @brief Устойчиво переставляет элементы, для которых pred истинен, в
+ * начало диапазона.
+ *
+ * pred вызывается ровно один раз для каждого элемента, параллельно из
+ * разных потоков.
+ *
+ * @return Итератор на первый элемент, для которого pred ложен.
+ */
+template <typename RandomIt, typename Predicate>
+RandomIt parallel_partition(RandomIt first, RandomIt last, Predicate pred,
+                            thread_pool &pool = default_thread_pool()) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  std::ptrdiff_t n = last - first;
+  std::size_t parts = std::max<std::size_t>(pool.thread_count(), 1);
+  if (n < parallel_detail::kSequentialCutoff || parts == 1) {
+    return std::stable_partition(first, last, pred);
+  }
+
+  // Первый проход: значения предиката и число истинных в каждом куске
+  std::vector<unsigned char> flags(static_cast<std::size_t>(n));
+  std::vector<std::size_t> true_at(parts);
+  std::vector<std::size_t> false_at(parts);
+  parallel_detail::forEachPart(
+      pool, n, parts,
+      [&](std::size_t part, std::ptrdiff_t begin, std::ptrdiff_t end) {
+        std::size_t matched = 0;
+        for (std::ptrdiff_t i = begin; i < end; ++i) {
+          bool flag = pred(first[i]);
+          flags[static_cast<std::size_t>(i)] = flag;
+          matched += flag;
+        }
+        true_at[part] = matched;
+        false_at[part] = static_cast<std::size_t>(end - begin) - matched;
+      });
+  std::size_t total_true = 0;
+  for (std::size_t matched : true_at) total_true += matched;
+  std::size_t next_true = 0;
+  std::size_t next_false = total_true;
+  for (std::size_t part = 0; part < parts; ++part) {
+    std::size_t matched = true_at[part];
+    std::size_t rest = false_at[part];
+    true_at[part] = next_true;
+    false_at[part] = next_false;
+    next_true += matched;
+    next_false += rest;
+  }
+
+  // Второй проход: раскладка в буфер по смещениям и перенос обратно
+  parallel_detail::TempBuffer<T> buffer(static_cast<std::size_t>(n));
+  T *buf = buffer.data();
+  parallel_detail::forEachPart(
+      pool, n, parts,
+      [&](std::size_t part, std::ptrdiff_t begin, std::ptrdiff_t end) {
+        std::size_t to_true = true_at[part];
+        std::size_t to_false = false_at[part];
+        for (std::ptrdiff_t i = begin; i < end; ++i) {
+          std::size_t to = flags[static_cast<std::size_t>(i)] ? to_true++
+                                                               : to_false++;
+          ::new (static_cast<void *>(buf + to)) T(std::move(first[i]));
+        }
+      });
+  buffer.construct_all();
+  parallel_detail::forEachPart(
+      pool, n, parts,
+      [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+        std::move(buf + begin, buf + end, first + begin);
+      });
+  return first + static_cast<std::ptrdiff_t>(total_true);
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_PARALLEL_S21_PARALLEL_SORT_H_
@@ -0,0 +1,72 @@
+// Бенчмарк параллельных сортировок s21::vector<int> случайных чисел:
+// std::sort как база, parallel_sort, parallel_stable_sort и radix_sort на
+// пуле из 1, 2, 4, ... потоков до числа ядер. Печатается время в
+// миллисекундах; каждая сортировка получает свежую копию исходных данных.
+//
+// Запуск: ./bench.out [количество элементов]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+#include "../vector/s21_vector.h"
+#include "s21_parallel_sort.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Sort>
+double TimeSort(const s21::vector<int> &source, Sort sort) {
+  s21::vector<int> values(source);
+  auto start = Clock::now();
+  sort(values);
+  double ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  if (!std::is_sorted(values.begin(), values.end())) std::printf("unsorted\n");
+  return ms;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 24;
+  unsigned cores = std::thread::hardware_concurrency();
+  if (cores == 0) cores = 1;
+
+  s21::vector<int> source;
+  source.reserve(size);
+  std::mt19937 rng(42);
+  for (std::size_t i = 0; i < size; ++i) {
+    source.push_back(static_cast<int>(rng()));
+  }
+
+  std::printf("%zu random ints, ms, %u cores\n", size, cores);
+  std::printf("  std::sort: %.1f\n", TimeSort(source, [](s21::vector<int> &v) {
+                std::sort(v.begin(), v.end());
+              }));
+  std::printf("  %8s %14s %14s %14s\n", "threads", "parallel_sort",
+              "stable_sort", "radix_sort");
+  // 1, 2, 4, ... и в конце ровно все ядра
+  for (unsigned threads = 1;; threads = std::min(threads * 2, cores)) {
+    s21::thread_pool pool(threads);
+    double sort_ms = TimeSort(source, [&](s21::vector<int> &v) {
+      s21::parallel_sort(v.begin(), v.end(), std::less<>(), pool);
+    });
+    double stable_ms = TimeSort(source, [&](s21::vector<int> &v) {
+      s21::parallel_stable_sort(v.begin(), v.end(), std::less<>(), pool);
+    });
+    double radix_ms = TimeSort(source, [&](s21::vector<int> &v) {
+      s21::radix_sort(v.begin(), v.end(), s21::parallel_detail::Identity(),
+                      pool);
+    });
+    std::printf("  %8u %14.1f %14.1f %14.1f\n", threads, sort_ms, stable_ms,
+                radix_ms);
+    if (threads == cores) break;
+  }
+  return 0;
+}
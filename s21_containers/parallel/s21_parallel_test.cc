@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "s21_parallel_sort.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+// Сумма [first, last) рекурсивным делением с ожиданием внутри задач
+long RecursiveSum(s21::thread_pool &pool, long first, long last) {
+  if (last - first <= 1000) {
+    long sum = 0;
+    for (long i = first; i < last; ++i) sum += i;
+    return sum;
+  }
+  long middle = first + (last - first) / 2;
+  long left = 0;
+  s21::task_group group(pool);
+  group.run([&] { left = RecursiveSum(pool, first, middle); });
+  long right = RecursiveSum(pool, middle, last);
+  group.wait();
+  return left + right;
+}
+
+std::vector<int> RandomInts(std::size_t size, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<int> values(size);
+  for (int &value : values) value = static_cast<int>(rng());
+  return values;
+}
+
+}  // namespace
+
+TEST(thread_pool, runs_nested_task_groups) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.thread_count(), 3U);
+  std::atomic<int> counter{0};
+  {
+    s21::task_group group(pool);
+    for (int i = 0; i < 1000; ++i) {
+      group.run([&] { counter.fetch_add(1); });
+    }
+    group.wait();
+  }
+  EXPECT_EQ(counter.load(), 1000);
+  EXPECT_EQ(RecursiveSum(pool, 0, 1000000), 999999L * 1000000L / 2);
+
+  s21::task_group failing(pool);
+  failing.run([] { throw std::runtime_error("task failed"); });
+  EXPECT_THROW(failing.wait(), std::runtime_error);
+}
+
+TEST(parallel_sort, matches_std_sort) {
+  s21::thread_pool pool(4);
+  for (std::size_t size : {0, 1, 1000, 100000, 300001}) {
+    std::vector<int> expected = RandomInts(size, 1);
+    s21::vector<int> values;
+    for (int value : expected) values.push_back(value);
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    s21::parallel_sort(values.begin(), values.end(), std::greater<>(), pool);
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin(),
+                           expected.end()));
+  }
+
+  std::vector<std::string> strings;
+  for (int value : RandomInts(50000, 2)) {
+    strings.push_back(std::to_string(value));
+  }
+  std::vector<std::string> expected = strings;
+  std::sort(expected.begin(), expected.end());
+  s21::parallel_sort(strings.begin(), strings.end(), std::less<>(), pool);
+  EXPECT_EQ(strings, expected);
+}
+
+TEST(parallel_sort, stable_sort_keeps_order_of_equal_keys) {
+  s21::thread_pool pool(4);
+  std::mt19937 rng(3);
+  std::vector<std::pair<int, int>> values;
+  for (int i = 0; i < 200000; ++i) {
+    values.emplace_back(static_cast<int>(rng() % 100), i);
+  }
+  std::vector<std::pair<int, int>> expected = values;
+  auto by_key = [](const auto &a, const auto &b) { return a.first < b.first; };
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  s21::parallel_stable_sort(values.begin(), values.end(), by_key, pool);
+  EXPECT_EQ(values, expected);
+}
+
+TEST(parallel_sort, radix_sort) {
+  s21::thread_pool pool(4);
+  std::vector<int> ints = RandomInts(200000, 4);
+  ints[5] = -1;
+  ints[6] = 0;
+  std::vector<int> expected = ints;
+  std::sort(expected.begin(), expected.end());
+  s21::radix_sort(ints.begin(), ints.end(), s21::parallel_detail::Identity(),
+                  pool);
+  EXPECT_EQ(ints, expected);
+
+  // Ключ по проекции: устойчиво, и одинаковые старшие байты пропускаются
+  std::mt19937 rng(5);
+  std::vector<std::pair<std::uint64_t, int>> records;
+  for (int i = 0; i < 100000; ++i) {
+    records.emplace_back(rng() % 1000, i);
+  }
+  auto by_key = [](const auto &a, const auto &b) { return a.first < b.first; };
+  std::vector<std::pair<std::uint64_t, int>> sorted = records;
+  std::stable_sort(sorted.begin(), sorted.end(), by_key);
+  s21::radix_sort(
+      records.begin(), records.end(),
+      [](const std::pair<std::uint64_t, int> &r) { return r.first; }, pool);
+  EXPECT_EQ(records, sorted);
+
+  std::vector<signed char> small{3, -7, 0, 127, -128, 5};
+  s21::radix_sort(small.begin(), small.end());
+  EXPECT_TRUE(std::is_sorted(small.begin(), small.end()));
+}
+
+TEST(parallel_sort, partition_is_stable) {
+  s21::thread_pool pool(4);
+  std::vector<int> values = RandomInts(150000, 6);
+  std::vector<int> expected = values;
+  auto even = [](int x) { return x % 2 == 0; };
+  auto expected_point =
+      std::stable_partition(expected.begin(), expected.end(), even);
+  auto point = s21::parallel_partition(values.begin(), values.end(), even,
+                                       pool);
+  EXPECT_EQ(point - values.begin(), expected_point - expected.begin());
+  EXPECT_EQ(values, expected);
+}
@@ -0,0 +1,235 @@
+/**
+ * @file s21_thread_pool.h
+ * @brief Пул потоков с перехватом задач (work stealing) и группы задач
+ * fork-join.
+ *
+ * У каждого рабочего потока своя очередь. Задачи, порожденные внутри
+ * рабочего потока, кладутся в его очередь; сам поток берет задачи с конца
+ * (последнюю добавленную - ее данные еще в кэше), а простаивающие потоки
+ * перехватывают задачи с начала чужих очередей - самые крупные при
+ * рекурсивном делении работы. Задачи извне распределяются по очередям по
+ * кругу.
+ *
+ * task_group::wait() не блокирует поток, а выполняет задачи пула, пока
+ * группа не завершится, поэтому рекурсивные алгоритмы могут ждать подзадачи
+ * изнутри задач без риска взаимной блокировки.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_PARALLEL_S21_THREAD_POOL_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_PARALLEL_S21_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * @class thread_pool
+ * @brief Фиксированный набор рабочих потоков с очередями задач.
+ */
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * @brief Запускает threads рабочих потоков (по умолчанию - по числу
+   * ядер).
+   *
+   * При threads == 0 потоков нет: задачи выполняют только потоки, ожидающие
+   * task_group.
+   */
+  explicit thread_pool(size_type threads = default_thread_count())
+      : queues_(std::make_unique<Queue[]>(std::max<size_type>(threads, 1))),
+        queue_count_(std::max<size_type>(threads, 1)) {
+    workers_.reserve(threads);
+    for (size_type i = 0; i < threads; ++i) {
+      workers_.emplace_back([this, i] { workerLoop(i); });
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  /// Дожидается выполнения всех поставленных задач и останавливает потоки.
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  static size_type default_thread_count() {
+    return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+  }
+
+  size_type thread_count() const { return workers_.size(); }
+
+  /// Ставит задачу в очередь. Задача не должна бросать исключений.
+  void submit(std::function<void()> task) {
+    size_type index = current_index_;
+    if (current_pool_ != this) {
+      index = next_queue_.fetch_add(1, std::memory_order_relaxed) %
+              queue_count_;
+    }
+    {
+      std::lock_guard<std::mutex> lock(queues_[index].mutex);
+      queues_[index].tasks.push_back(std::move(task));
+    }
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      ++pending_;
+    }
+    wake_.notify_one();
+  }
+
+  /**
+   * @brief Выполняет в текущем потоке одну задачу из очередей пула.
+   *
+   * @return false, если очереди пусты.
+   */
+  bool run_pending_task() {
+    size_type home = current_pool_ == this ? current_index_ : 0;
+    std::function<void()> task;
+    if (!popTask(home, task)) return false;
+    task();
+    return true;
+  }
+
+ private:
+  // Очередь каждого потока в своей строке кэша
+  struct alignas(64) Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::unique_ptr<Queue[]> queues_;
+  size_type queue_count_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_type> next_queue_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  size_type pending_ = 0;  // Под sleep_mutex_
+  bool stop_ = false;      // Под sleep_mutex_
+
+  inline static thread_local thread_pool *current_pool_ = nullptr;
+  inline static thread_local size_type current_index_ = 0;
+
+  /// Берет задачу с конца своей очереди или с начала чужой.
+  bool popTask(size_type home, std::function<void()> &task) {
+    for (size_type step = 0; step < queue_count_; ++step) {
+      Queue &queue = queues_[(home + step) % queue_count_];
+      std::unique_lock<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) continue;
+      if (step == 0) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+      lock.unlock();
+      std::lock_guard<std::mutex> sleep_lock(sleep_mutex_);
+      --pending_;
+      return true;
+    }
+    return false;
+  }
+
+  void workerLoop(size_type index) {
+    current_pool_ = this;
+    current_index_ = index;
+    std::function<void()> task;
+    while (true) {
+      if (popTask(index, task)) {
+        task();
+        task = nullptr;
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait(lock, [this] { return stop_ || pending_ > 0; });
+      if (stop_ && pending_ == 0) return;
+    }
+  }
+};
+
+/**
+ * @class task_group
+ * @brief Группа задач, которую можно дождаться целиком.
+ *
+ * Исключение, брошенное задачей, сохраняется и передается из wait(); при
+ * нескольких исключениях передается первое.
+ */
+class task_group {
+ public:
+  explicit task_group(thread_pool &pool) : pool_(pool) {}
+
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+
+  ~task_group() {
+    try {
+      wait();
+    } catch (...) {
+    }
+  }
+
+  template <typename F>
+  void run(F &&f) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.submit([this, f = std::forward<F>(f)]() mutable {
+      try {
+        f();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        if (!error_) error_ = std::current_exception();
+      }
+      // Последнее обращение к группе: после него wait() может вернуться
+      pending_.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  /// Выполняет задачи пула, пока не завершатся все задачи группы.
+  void wait() {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+      if (!pool_.run_pending_task()) std::this_thread::yield();
+    }
+    std::exception_ptr error;
+    {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      std::swap(error, error_);
+    }
+    if (error) std::rethrow_exception(error);
+  }
+
+ private:
+  thread_pool &pool_;
+  std::atomic<std::size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+/// Общий пул по числу ядер, создается при первом обращении.
+inline thread_pool &default_thread_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_PARALLEL_S21_THREAD_POOL_H_
@@ -0,0 +1,543 @@
+/**
+ * @file s21_segmented_vector.h
+ * @brief Вектор из сегментов, размеры которых растут степенями двойки.
+ *
+ * Класс segmented_vector хранит элементы в сегментах размером B, 2B, 4B,
+ * ... (B - степень двойки), указатели на которые лежат в таблице
+ * фиксированного размера внутри объекта. При росте добавляется новый
+ * сегмент, а уже созданные элементы никогда не переносятся: push_back не
+ * копирует старые данные, а ссылки и указатели на элементы остаются
+ * действительными до их удаления.
+ *
+ * Индекс переводится в пару (сегмент, смещение) за O(1): для j = i + B
+ * номер сегмента - это номер старшего бита j минус log2(B).
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SEGMENTED_VECTOR_S21_SEGMENTED_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SEGMENTED_VECTOR_S21_SEGMENTED_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @class segmented_vector
+ * @brief Динамический массив без переноса элементов при росте.
+ *
+ * reserve, push_back, emplace_back и resize в большую сторону не делают
+ * недействительными ссылки и указатели на элементы. Итераторы хранят адрес
+ * контейнера и становятся недействительными при его перемещении или
+ * обмене. insert и erase сдвигают хвост, как у s21::vector.
+ *
+ * @tparam T Тип элементов.
+ * @tparam Allocator Аллокатор для сегментов.
+ * @tparam FirstSegment Размер первого сегмента, степень двойки.
+ */
+template <typename T, typename Allocator = std::allocator<T>,
+          std::size_t FirstSegment = 16>
+class segmented_vector {
+  static_assert(FirstSegment > 0 &&
+                    (FirstSegment & (FirstSegment - 1)) == 0,
+                "segmented_vector: FirstSegment must be a power of two");
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  /**
+   * @brief Итератор произвольного доступа по элементам.
+   *
+   * Помимо индекса хранит указатель на элемент и границы его сегмента,
+   * поэтому ++ и -- обращаются к таблице сегментов только на границе.
+   *
+   * @tparam Const Если true, итератор дает только чтение элементов.
+   */
+  template <bool Const>
+  class IteratorBase {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+    using iterator_category = std::random_access_iterator_tag;
+    using ContainerPtr = std::conditional_t<Const, const segmented_vector *,
+                                            segmented_vector *>;
+
+    IteratorBase() = default;
+    IteratorBase(ContainerPtr owner, size_type index)
+        : owner_(owner), index_(index) {
+      seek();
+    }
+    // Неконстантный итератор неявно приводится к константному
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorBase(const IteratorBase<OtherConst> &other)
+        : IteratorBase(other.owner(), other.index()) {}
+
+    reference operator*() const { return *ptr_; }
+    pointer operator->() const { return ptr_; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    IteratorBase &operator++() {
+      ++index_;
+      if (++ptr_ == segment_end_) seek();
+      return *this;
+    }
+    IteratorBase operator++(int) {
+      IteratorBase tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    IteratorBase &operator--() {
+      --index_;
+      if (ptr_ == segment_begin_) {
+        seek();
+      } else {
+        --ptr_;
+      }
+      return *this;
+    }
+    IteratorBase operator--(int) {
+      IteratorBase tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    IteratorBase &operator+=(difference_type n) {
+      index_ = static_cast<size_type>(static_cast<difference_type>(index_) +
+                                      n);
+      seek();
+      return *this;
+    }
+    IteratorBase &operator-=(difference_type n) { return *this += -n; }
+    friend IteratorBase operator+(IteratorBase it, difference_type n) {
+      return it += n;
+    }
+    friend IteratorBase operator+(difference_type n, IteratorBase it) {
+      return it += n;
+    }
+    friend IteratorBase operator-(IteratorBase it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const IteratorBase &a,
+                                     const IteratorBase &b) {
+      return static_cast<difference_type>(a.index_) -
+             static_cast<difference_type>(b.index_);
+    }
+
+    bool operator==(const IteratorBase &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const IteratorBase &other) const {
+      return index_ != other.index_;
+    }
+    bool operator<(const IteratorBase &other) const {
+      return index_ < other.index_;
+    }
+    bool operator>(const IteratorBase &other) const {
+      return index_ > other.index_;
+    }
+    bool operator<=(const IteratorBase &other) const {
+      return index_ <= other.index_;
+    }
+    bool operator>=(const IteratorBase &other) const {
+      return index_ >= other.index_;
+    }
+
+    ContainerPtr owner() const { return owner_; }
+    size_type index() const { return index_; }
+
+   private:
+    ContainerPtr owner_ = nullptr;
+    size_type index_ = 0;
+    pointer ptr_ = nullptr;
+    pointer segment_begin_ = nullptr;
+    pointer segment_end_ = nullptr;
+
+    /// Находит сегмент для index_; за выделенными сегментами - пустой.
+    void seek() {
+      size_type segment = segmentOf(index_);
+      if (segment >= owner_->segment_count_) {
+        ptr_ = segment_begin_ = segment_end_ = nullptr;
+        return;
+      }
+      segment_begin_ = owner_->segments_[segment];
+      segment_end_ = segment_begin_ + segmentSize(segment);
+      ptr_ = segment_begin_ + offsetIn(index_, segment);
+    }
+  };
+
+  using iterator = IteratorBase<false>;
+  using const_iterator = IteratorBase<true>;
+
+  /// Размер первого сегмента.
+  static constexpr size_type first_segment_size = FirstSegment;
+
+  segmented_vector() = default;
+
+  explicit segmented_vector(const allocator_type &alloc) : alloc_(alloc) {}
+
+  explicit segmented_vector(size_type n,
+                            const allocator_type &alloc = allocator_type())
+      : alloc_(alloc) {
+    resize(n);
+  }
+
+  explicit segmented_vector(std::initializer_list<value_type> const &items,
+                            const allocator_type &alloc = allocator_type())
+      : alloc_(alloc) {
+    appendRange(items.begin(), items.end(), items.size());
+  }
+
+  segmented_vector(const segmented_vector &other)
+      : alloc_(AllocTraits::select_on_container_copy_construction(
+            other.alloc_)) {
+    appendRange(other.cbegin(), other.cend(), other.size_);
+  }
+
+  /// Забирает таблицу сегментов целиком, элементы не переносятся.
+  segmented_vector(segmented_vector &&other) noexcept
+      : alloc_(std::move(other.alloc_)) {
+    takeFrom(other);
+  }
+
+  segmented_vector &operator=(const segmented_vector &other) {
+    if (this != &other) {
+      clear();
+      if constexpr (AllocTraits::propagate_on_container_copy_assignment::
+                        value) {
+        // Сегменты возвращаются аллокатору, который их выделил
+        if (alloc_ != other.alloc_) releaseSegments(0);
+        alloc_ = other.alloc_;
+      }
+      appendRange(other.cbegin(), other.cend(), other.size_);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Забирает сегменты other. Если аллокатор не переносится при
+   * перемещении и аллокаторы не равны, сегменты other остаются у него, а
+   * элементы перемещаются по одному в свои сегменты.
+   */
+  segmented_vector &operator=(segmented_vector &&other) noexcept(
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value) {
+    if (this == &other) return *this;
+    clear();
+    if constexpr (!AllocTraits::propagate_on_container_move_assignment::
+                      value) {
+      if (alloc_ != other.alloc_) {
+        appendRange(std::make_move_iterator(other.begin()),
+                    std::make_move_iterator(other.end()), other.size_);
+        other.clear();
+        return *this;
+      }
+    }
+    releaseSegments(0);
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(other.alloc_);
+    }
+    takeFrom(other);
+    return *this;
+  }
+
+  ~segmented_vector() {
+    clear();
+    releaseSegments(0);
+  }
+
+  reference at(size_type pos) {
+    checkIndex(pos);
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    checkIndex(pos);
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) { return *address(pos); }
+  const_reference operator[](size_type pos) const { return *address(pos); }
+  reference front() { return *segments_[0]; }
+  const_reference front() const { return *segments_[0]; }
+  reference back() { return *address(size_ - 1); }
+  const_reference back() const { return *address(size_ - 1); }
+  allocator_type get_allocator() const { return alloc_; }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cbegin() const { return const_iterator(this, 0); }
+  const_iterator cend() const { return const_iterator(this, size_); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return segmentStart(segment_count_); }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  /// Количество выделенных сегментов.
+  size_type segment_count() const { return segment_count_; }
+
+  /// Добавляет сегменты до емкости не меньше new_capacity.
+  void reserve(size_type new_capacity) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("segmented_vector::reserve: capacity " +
+                              std::to_string(new_capacity) +
+                              " exceeds max_size");
+    }
+    while (capacity() < new_capacity) {
+      addSegment();
+    }
+    syncTail();
+  }
+
+  /// Освобождает сегменты, в которых не осталось элементов.
+  void shrink_to_fit() {
+    size_type keep = size_ == 0 ? 0 : segmentOf(size_ - 1) + 1;
+    releaseSegments(keep);
+    syncTail();
+  }
+
+  /// Удаляет элементы, сохраняя сегменты.
+  void clear() {
+    destroyFrom(0);
+    size_ = 0;
+    syncTail();
+  }
+
+  void resize(size_type n) {
+    growTo(n, [this](value_type *p) { AllocTraits::construct(alloc_, p); });
+  }
+
+  void resize(size_type n, const_reference value) {
+    value_type copy(value);
+    growTo(n, [this, &copy](value_type *p) {
+      AllocTraits::construct(alloc_, p, copy);
+    });
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  /**
+   * @brief Создает элемент в конце.
+   *
+   * Существующие элементы не переносятся, поэтому аргументы могут ссылаться
+   * на элементы самого вектора.
+   */
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (tail_ == tail_end_) {
+      if (size_ == capacity()) addSegment();
+      syncTail();
+    }
+    AllocTraits::construct(alloc_, tail_, std::forward<Args>(args)...);
+    ++size_;
+    return *tail_++;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  void pop_back() {
+    --size_;
+    syncTail();
+    AllocTraits::destroy(alloc_, tail_);
+  }
+
+  /**
+   * @brief Вставляет элемент перед pos, сдвигая хвост на одну позицию.
+   *
+   * @return Итератор на вставленный элемент.
+   */
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = pos.index();
+    emplace_back(std::forward<Args>(args)...);
+    iterator first = begin() + static_cast<difference_type>(index);
+    std::rotate(first, end() - 1, end());
+    return first;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  void erase(const_iterator pos) {
+    iterator first = begin() + static_cast<difference_type>(pos.index());
+    std::move(std::next(first), end(), first);
+    pop_back();
+  }
+
+  /// Обменивает таблицы сегментов, элементы не переносятся.
+  void swap(segmented_vector &other) {
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+    std::swap(segments_, other.segments_);
+    std::swap(segment_count_, other.segment_count_);
+    std::swap(size_, other.size_);
+    std::swap(tail_, other.tail_);
+    std::swap(tail_end_, other.tail_end_);
+  }
+
+ private:
+  static constexpr size_type kDigits = std::numeric_limits<size_type>::digits;
+  static constexpr size_type kFirstShift = [] {
+    size_type shift = 0;
+    while ((size_type{1} << shift) < FirstSegment) ++shift;
+    return shift;
+  }();
+  static constexpr size_type kMaxSegments = kDigits - kFirstShift;
+
+  value_type *segments_[kMaxSegments] = {};
+  size_type segment_count_ = 0;
+  size_type size_ = 0;
+  // Место под следующий push_back и конец его сегмента; равны, если
+  // сегмент заполнен или еще не выделен
+  value_type *tail_ = nullptr;
+  value_type *tail_end_ = nullptr;
+  allocator_type alloc_;
+
+  static size_type segmentSize(size_type segment) {
+    return FirstSegment << segment;
+  }
+
+  /// Индекс первого элемента сегмента (и емкость всех сегментов до него).
+  static size_type segmentStart(size_type segment) {
+    return (FirstSegment << segment) - FirstSegment;
+  }
+
+  static size_type segmentOf(size_type index) {
+    size_type j = index + FirstSegment;
+    return kDigits - 1 - static_cast<size_type>(__builtin_clzll(j)) -
+           kFirstShift;
+  }
+
+  static size_type offsetIn(size_type index, size_type segment) {
+    return index - segmentStart(segment);
+  }
+
+  value_type *address(size_type index) const {
+    size_type segment = segmentOf(index);
+    return segments_[segment] + offsetIn(index, segment);
+  }
+
+  void checkIndex(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("segmented_vector::at: index " +
+                              std::to_string(pos) + " >= size " +
+                              std::to_string(size_));
+    }
+  }
+
+  void addSegment() {
+    if (segment_count_ == kMaxSegments) {
+      throw std::length_error("segmented_vector: too many segments");
+    }
+    segments_[segment_count_] =
+        AllocTraits::allocate(alloc_, segmentSize(segment_count_));
+    ++segment_count_;
+  }
+
+  /// Освобождает сегменты начиная с keep; элементов в них быть не должно.
+  void releaseSegments(size_type keep) {
+    while (segment_count_ > keep) {
+      --segment_count_;
+      AllocTraits::deallocate(alloc_, segments_[segment_count_],
+                              segmentSize(segment_count_));
+      segments_[segment_count_] = nullptr;
+    }
+  }
+
+  void syncTail() {
+    if (size_ == capacity()) {
+      tail_ = tail_end_ = nullptr;
+      return;
+    }
+    size_type segment = segmentOf(size_);
+    tail_ = segments_[segment] + offsetIn(size_, segment);
+    tail_end_ = segments_[segment] + segmentSize(segment);
+  }
+
+  /// Разрушает элементы [first, size_) посегментно, size_ не меняет.
+  void destroyFrom(size_type first) {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      while (first < size_) {
+        size_type segment = segmentOf(first);
+        size_type last = std::min(size_, segmentStart(segment + 1));
+        value_type *p = segments_[segment] + offsetIn(first, segment);
+        for (size_type i = first; i < last; ++i, ++p) {
+          AllocTraits::destroy(alloc_, p);
+        }
+        first = last;
+      }
+    }
+  }
+
+  template <typename It>
+  void appendRange(It first, It last, size_type count) {
+    reserve(size_ + count);
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+
+  /// Забирает сегменты other, оставляя его пустым.
+  void takeFrom(segmented_vector &other) {
+    std::copy(std::begin(other.segments_), std::end(other.segments_),
+              std::begin(segments_));
+    std::fill(std::begin(other.segments_), std::end(other.segments_),
+              nullptr);
+    segment_count_ = std::exchange(other.segment_count_, 0);
+    size_ = std::exchange(other.size_, 0);
+    tail_ = std::exchange(other.tail_, nullptr);
+    tail_end_ = std::exchange(other.tail_end_, nullptr);
+  }
+
+  template <typename Init>
+  void growTo(size_type n, Init init) {
+    if (n <= size_) {
+      destroyFrom(n);
+      size_ = n;
+      syncTail();
+      return;
+    }
+    reserve(n);
+    while (size_ < n) {
+      init(tail_);
+      ++size_;
+      if (++tail_ == tail_end_) syncTail();
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SEGMENTED_VECTOR_S21_SEGMENTED_VECTOR_H_
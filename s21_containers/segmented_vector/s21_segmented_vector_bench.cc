@@ -0,0 +1,70 @@
+// Бенчмарк задержек push_back: s21::segmented_vector против s21::vector.
+// Каждый вызов замеряется отдельно, печатаются перцентили в наносекундах
+// (в них входит и стоимость чтения часов). У s21::vector хвост
+// распределения - переносы всего массива при росте; segmented_vector
+// только выделяет новый сегмент.
+//
+// Запуск: ./bench.out [количество элементов]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "s21_segmented_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Vector, typename Make>
+void Run(const char *name, std::size_t size, Make make) {
+  std::vector<long> latencies(size);
+  Vector vector;
+  auto total_start = Clock::now();
+  for (std::size_t i = 0; i < size; ++i) {
+    auto value = make(i);
+    auto start = Clock::now();
+    vector.push_back(std::move(value));
+    latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       Clock::now() - start)
+                       .count();
+  }
+  double total_ms = std::chrono::duration<double, std::milli>(
+                        Clock::now() - total_start)
+                        .count();
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p) {
+    return latencies[static_cast<std::size_t>(p * (size - 1))];
+  };
+  std::printf("  %-28s %8ld %8ld %8ld %10ld %12ld %10.1f\n", name,
+              percentile(0.5), percentile(0.99), percentile(0.999),
+              percentile(0.9999), latencies.back(), total_ms);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+  if (size == 0) return 0;
+
+  auto make_int = [](std::size_t i) { return static_cast<int>(i); };
+  auto make_string = [](std::size_t i) {
+    return std::string(32, static_cast<char>('a' + i % 26));
+  };
+
+  std::printf("%zu push_back calls, latency in ns, total in ms\n", size);
+  std::printf("  %-28s %8s %8s %8s %10s %12s %10s\n", "container", "p50",
+              "p99", "p99.9", "p99.99", "max", "total");
+  Run<s21::vector<int>>("s21::vector<int>", size, make_int);
+  Run<s21::segmented_vector<int>>("s21::segmented_vector<int>", size,
+                                  make_int);
+  Run<s21::vector<std::string>>("s21::vector<string>", size / 4,
+                                make_string);
+  Run<s21::segmented_vector<std::string>>("s21::segmented_vector<string>",
+                                          size / 4, make_string);
+  return 0;
+}
@@ -0,0 +1,130 @@
+#include "s21_segmented_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../test_support/tracking_resource.h"
+
+using s21::test_support::CopyPropagatingAllocator;
+using s21::test_support::TrackingResource;
+
+TEST(segmented_vector, references_survive_growth) {
+  s21::segmented_vector<int, std::allocator<int>, 4> vector;
+  EXPECT_EQ(vector.capacity(), 0U);
+  vector.push_back(0);
+  const int *first = &vector[0];
+  std::vector<const int *> addresses;
+  for (int i = 1; i < 1000; ++i) {
+    // аргумент-ссылка на элемент: элементы при росте не переносятся
+    vector.push_back(vector[i - 1] + 1);
+    addresses.push_back(&vector.back());
+  }
+  EXPECT_EQ(&vector[0], first);
+  for (int i = 1; i < 1000; ++i) {
+    EXPECT_EQ(vector[i], i);
+    EXPECT_EQ(&vector[i], addresses[i - 1]);
+  }
+  // сегменты 4, 8, 16, ..., 512 дают емкость 1020
+  EXPECT_EQ(vector.segment_count(), 8U);
+  EXPECT_EQ(vector.capacity(), 1020U);
+  EXPECT_THROW(vector.at(1000), std::out_of_range);
+}
+
+TEST(segmented_vector, iterators_and_algorithms) {
+  s21::segmented_vector<int> vector;
+  std::vector<int> expected;
+  for (int i = 0; i < 5000; ++i) {
+    int value = (i * 7919) % 5003;
+    vector.push_back(value);
+    expected.push_back(value);
+  }
+  std::sort(vector.begin(), vector.end());
+  std::sort(expected.begin(), expected.end());
+  EXPECT_TRUE(std::equal(vector.cbegin(), vector.cend(), expected.begin(),
+                         expected.end()));
+  auto it = std::lower_bound(vector.begin(), vector.end(), 2500);
+  EXPECT_EQ(*it, expected[it - vector.begin()]);
+  EXPECT_EQ(vector.end() - vector.begin(), 5000);
+
+  // обход назад через границы сегментов
+  auto back = vector.end();
+  for (int i = 4999; i >= 0; --i) {
+    --back;
+    ASSERT_EQ(*back, expected[i]);
+  }
+  s21::segmented_vector<int>::const_iterator const_it = vector.begin() + 17;
+  EXPECT_EQ(const_it[3], expected[20]);
+}
+
+TEST(segmented_vector, insert_erase_resize) {
+  s21::segmented_vector<std::string> vector{"a", "c"};
+  vector.insert(vector.cbegin() + 1, "b");
+  vector.insert_many_back("d", "e");
+  vector.erase(vector.cbegin());
+  std::vector<std::string> expected{"b", "c", "d", "e"};
+  EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(),
+                         expected.end()));
+
+  vector.resize(100, "x");
+  EXPECT_EQ(vector.size(), 100U);
+  EXPECT_EQ(vector.back(), "x");
+  vector.resize(3);
+  EXPECT_EQ(vector.back(), "d");
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.segment_count(), 1U);
+
+  s21::segmented_vector<std::string> copy(vector);
+  s21::segmented_vector<std::string> moved(std::move(vector));
+  EXPECT_TRUE(vector.empty());
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved[2], "d");
+  moved.swap(copy);
+  moved.pop_back();
+  EXPECT_EQ(moved.size(), 2U);
+  EXPECT_EQ(copy.front(), "b");
+}
+
+TEST(segmented_vector, assign_between_unequal_allocators) {
+  using Allocator = std::pmr::polymorphic_allocator<int>;
+  using Vector = s21::segmented_vector<int, Allocator, 4>;
+  static_assert(!std::is_nothrow_move_assignable_v<Vector>);
+  static_assert(
+      std::is_nothrow_move_assignable_v<s21::segmented_vector<int>>);
+  TrackingResource first, second;
+  {
+    Vector target{Allocator(&first)};
+    Vector source{Allocator(&second)};
+    for (int i = 0; i < 100; ++i) {
+      target.push_back(i);
+      source.push_back(-i);
+    }
+    // polymorphic_allocator не переносится: сегменты second остаются у него
+    target = std::move(source);
+    EXPECT_EQ(target.size(), 100U);
+    EXPECT_EQ(target[99], -99);
+    EXPECT_EQ(target.get_allocator().resource(), &first);
+    EXPECT_TRUE(source.empty());
+
+    using Propagating = CopyPropagatingAllocator<int>;
+    using CopyVector = s21::segmented_vector<int, Propagating, 4>;
+    CopyVector copy_target{Propagating(&first)};
+    CopyVector copy_source{Propagating(&second)};
+    for (int i = 0; i < 50; ++i) {
+      copy_target.push_back(i);
+      copy_source.push_back(-i);
+    }
+    copy_target = copy_source;
+    EXPECT_EQ(copy_target.get_allocator().resource, &second);
+    EXPECT_EQ(copy_target.size(), 50U);
+    EXPECT_EQ(copy_target[49], -49);
+  }
+  EXPECT_EQ(first.foreign, 0);
+  EXPECT_EQ(second.foreign, 0);
+  EXPECT_TRUE(first.live.empty());
+  EXPECT_TRUE(second.live.empty());
+}
@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <limits>
+#include <vector>
 
 #include "../tree/redblacktree.h"
 
@@ -31,6 +32,8 @@ class set {
   using size_type = std::size_t;
   using iterator = typename RedBlackTree<Key, Compare>::Iterator;
   using const_iterator = typename RedBlackTree<Key, Compare>::ConstIterator;
+  using insert_range_stats =
+      typename RedBlackTree<Key, Compare>::InsertRangeStats;
 
   set() : tree_() {}
   set(std::initializer_list<value_type> const& items) : tree_() {
@@ -81,6 +84,13 @@ class set {
     }
   }
 
+  // Пакетная вставка: диапазон сортируется (если нужно) и сливается с деревом
+  // за один проход, каждый спуск начинается от места предыдущей вставки.
+  template <typename InputIt>
+  insert_range_stats insert_range(InputIt first, InputIt last) {
+    return tree_.insert_range(first, last);
+  }
+
   void erase(iterator pos) {
     // используем оператор разыменования итератора для доступа к ключу
     Key key_to_remove = *pos;
@@ -103,6 +113,19 @@ class set {
     return iterator(node_ptr);
   }
 
+  // Пакетный поиск: спуски по дереву чередуются, промахи кэша перекрываются.
+  // Для отсутствующих ключей возвращается end().
+  std::vector<iterator> find_many(const std::vector<Key>& keys,
+                                  size_type group_size = 16) {
+    auto nodes = tree_.find_many(keys, group_size);
+    std::vector<iterator> results;
+    results.reserve(nodes.size());
+    for (const auto& node : nodes) {
+      results.push_back(node ? iterator(node) : end());
+    }
+    return results;
+  }
+
   bool contains(const Key& key) {
     // Если find() не возвращает end(), элемент существует
     return find(key) != end();
@@ -379,4 +379,32 @@ TEST(SetTest, CopyConstructor) {
   EXPECT_TRUE(copied_set.contains(1));
   EXPECT_TRUE(copied_set.contains(2));
   EXPECT_TRUE(original_set.contains(1));  // original should be unaffected
-}
\ No newline at end of file
+}
+
+TEST(SetTest, FindMany) {
+  s21::set<int> my_set = {10, 20, 30};
+
+  auto results = my_set.find_many({20, 25, 10});
+
+  ASSERT_EQ(results.size(), 3U);
+  EXPECT_EQ(*results[0], 20);
+  EXPECT_TRUE(results[1] == my_set.end());
+  EXPECT_EQ(*results[2], 10);
+}
+
+TEST(SetTest, InsertRange) {
+  s21::set<int> my_set = {5, 10};
+  std::vector<int> batch{9, 1, 5, 3, 1};
+  std::set<int> std_set = {5, 10};
+  std_set.insert(batch.begin(), batch.end());
+
+  auto stats = my_set.insert_range(batch.begin(), batch.end());
+
+  EXPECT_EQ(stats.inserted, 3U);
+  EXPECT_EQ(stats.existing, 2U);
+  ASSERT_EQ(my_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = my_set.begin(); it != my_set.end(); ++it, ++std_it) {
+    EXPECT_EQ(*it, *std_it);
+  }
+}
@@ -0,0 +1,449 @@
+/**
+ * @file algorithm.h
+ * @brief Векторизованные алгоритмы над непрерывными диапазонами
+ * арифметических типов.
+ *
+ * fill, find, count, minmax, accumulate и transform принимают указатели
+ * (итераторы s21::vector и s21::array - это указатели) или сам контейнер.
+ * Для целых типов, float и double выбирается AVX2-ядро, если процессор его
+ * поддерживает (cpufeatures.h), иначе и для остальных типов выполняется
+ * обычный скалярный цикл. Результаты совпадают со стандартными алгоритмами,
+ * кроме двух случаев:
+ * - accumulate для float и double складывает восемь (четыре) частичных сумм
+ *   параллельно, поэтому ошибка округления может отличаться от
+ *   последовательного сложения;
+ * - minmax при наличии NaN возвращает неопределенный результат.
+ *
+ * Пример:
+ * @code
+ * s21::vector<float> v(1000);
+ * s21::simd::fill(v, 1.5f);
+ * float total = s21::simd::accumulate(v, 0.0f);
+ * s21::simd::transform(v.begin(), v.end(), v.begin(),
+ *                      [](float x) { return x * 2 + 1; });
+ * @endcode
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SIMD_ALGORITHM_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SIMD_ALGORITHM_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "cpufeatures.h"
+
+namespace s21 {
+namespace simd {
+namespace detail {
+
+/// Запрещает вывод T из аргумента (аналог std::type_identity_t из C++20).
+template <typename T>
+struct NonDeduced {
+  using type = T;
+};
+template <typename T>
+using NonDeducedT = typename NonDeduced<T>::type;
+
+/// Типы, которые обрабатываются векторными ядрами. bool исключен: байтовая
+/// арифметика дает в нем значения, отличные от 0 и 1.
+template <typename T>
+inline constexpr bool kVectorizable =
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/// Есть ли для T векторные min/max (в AVX2 нет 64-битных целых).
+template <typename T>
+inline constexpr bool kHasMinMax =
+    kVectorizable<T> && (sizeof(T) < 8 || std::is_floating_point_v<T>);
+
+#if S21_SIMD_AVX2
+
+template <typename T>
+inline constexpr std::ptrdiff_t kLanes = 32 / sizeof(T);
+
+template <typename Bits, typename T>
+Bits bitsOf(T value) {
+  Bits bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+template <typename T>
+S21_TARGET_AVX2 inline __m256i load(const T* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+
+template <typename T>
+S21_TARGET_AVX2 inline void store(T* p, __m256i v) {
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+
+/// Регистр, во всех элементах которого лежит value.
+template <typename T>
+S21_TARGET_AVX2 inline __m256i broadcast(T value) {
+  if constexpr (sizeof(T) == 1) {
+    return _mm256_set1_epi8(bitsOf<char>(value));
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_set1_epi16(bitsOf<short>(value));
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_set1_epi32(bitsOf<int>(value));
+  } else {
+    return _mm256_set1_epi64x(bitsOf<long long>(value));
+  }
+}
+
+/**
+ * @brief Маска элементов блока p, равных needle: по sizeof(T) битов на
+ * элемент. Для float и double сравнение численное (0.0 == -0.0, NaN не равен
+ * ничему), для целых - побитовое.
+ */
+template <typename T>
+S21_TARGET_AVX2 inline unsigned equalMask(const T* p, __m256i needle) {
+  __m256i block = load(p);
+  __m256i equal;
+  if constexpr (std::is_same_v<T, float>) {
+    equal = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(block),
+                                              _mm256_castsi256_ps(needle),
+                                              _CMP_EQ_OQ));
+  } else if constexpr (std::is_same_v<T, double>) {
+    equal = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(block),
+                                              _mm256_castsi256_pd(needle),
+                                              _CMP_EQ_OQ));
+  } else if constexpr (sizeof(T) == 1) {
+    equal = _mm256_cmpeq_epi8(block, needle);
+  } else if constexpr (sizeof(T) == 2) {
+    equal = _mm256_cmpeq_epi16(block, needle);
+  } else if constexpr (sizeof(T) == 4) {
+    equal = _mm256_cmpeq_epi32(block, needle);
+  } else {
+    equal = _mm256_cmpeq_epi64(block, needle);
+  }
+  return static_cast<unsigned>(_mm256_movemask_epi8(equal));
+}
+
+template <typename T>
+S21_TARGET_AVX2 inline __m256i add(__m256i a, __m256i b) {
+  if constexpr (std::is_same_v<T, float>) {
+    return _mm256_castps_si256(
+        _mm256_add_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+  } else if constexpr (std::is_same_v<T, double>) {
+    return _mm256_castpd_si256(
+        _mm256_add_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b)));
+  } else if constexpr (sizeof(T) == 1) {
+    return _mm256_add_epi8(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return _mm256_add_epi16(a, b);
+  } else if constexpr (sizeof(T) == 4) {
+    return _mm256_add_epi32(a, b);
+  } else {
+    return _mm256_add_epi64(a, b);
+  }
+}
+
+/// Поэлементный минимум (Max = false) или максимум (Max = true).
+template <typename T, bool Max>
+S21_TARGET_AVX2 inline __m256i extremum(__m256i a, __m256i b) {
+  if constexpr (std::is_same_v<T, float>) {
+    __m256 x = _mm256_castsi256_ps(a);
+    __m256 y = _mm256_castsi256_ps(b);
+    return _mm256_castps_si256(Max ? _mm256_max_ps(x, y)
+                                   : _mm256_min_ps(x, y));
+  } else if constexpr (std::is_same_v<T, double>) {
+    __m256d x = _mm256_castsi256_pd(a);
+    __m256d y = _mm256_castsi256_pd(b);
+    return _mm256_castpd_si256(Max ? _mm256_max_pd(x, y)
+                                   : _mm256_min_pd(x, y));
+  } else if constexpr (sizeof(T) == 1 && std::is_signed_v<T>) {
+    return Max ? _mm256_max_epi8(a, b) : _mm256_min_epi8(a, b);
+  } else if constexpr (sizeof(T) == 1) {
+    return Max ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+  } else if constexpr (sizeof(T) == 2 && std::is_signed_v<T>) {
+    return Max ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b);
+  } else if constexpr (sizeof(T) == 2) {
+    return Max ? _mm256_max_epu16(a, b) : _mm256_min_epu16(a, b);
+  } else if constexpr (std::is_signed_v<T>) {
+    return Max ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b);
+  } else {
+    return Max ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b);
+  }
+}
+
+template <typename T>
+S21_TARGET_AVX2 void fillAvx2(T* first, T* last, T value) {
+  __m256i pattern = broadcast(value);
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    store(first, pattern);
+  }
+  std::fill(first, last, value);
+}
+
+template <typename T>
+S21_TARGET_AVX2 const T* findAvx2(const T* first, const T* last, T value) {
+  __m256i needle = broadcast(value);
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    unsigned mask = equalMask(first, needle);
+    if (mask != 0) {
+      return first + static_cast<unsigned>(__builtin_ctz(mask)) / sizeof(T);
+    }
+  }
+  return std::find(first, last, value);
+}
+
+template <typename T>
+S21_TARGET_AVX2 std::size_t countAvx2(const T* first, const T* last,
+                                      T value) {
+  __m256i needle = broadcast(value);
+  std::size_t bits = 0;
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    bits += static_cast<std::size_t>(
+        __builtin_popcount(equalMask(first, needle)));
+  }
+  return bits / sizeof(T) +
+         static_cast<std::size_t>(std::count(first, last, value));
+}
+
+template <typename T>
+S21_TARGET_AVX2 std::pair<T, T> minmaxAvx2(const T* first, const T* last) {
+  T low = *first;
+  T high = *first;
+  if (last - first >= kLanes<T>) {
+    __m256i low_lanes = load(first);
+    __m256i high_lanes = low_lanes;
+    for (first += kLanes<T>; last - first >= kLanes<T>; first += kLanes<T>) {
+      __m256i block = load(first);
+      low_lanes = extremum<T, false>(low_lanes, block);
+      high_lanes = extremum<T, true>(high_lanes, block);
+    }
+    T lanes[kLanes<T>];
+    store(lanes, low_lanes);
+    for (T lane : lanes) low = std::min(low, lane);
+    store(lanes, high_lanes);
+    for (T lane : lanes) high = std::max(high, lane);
+  }
+  for (; first != last; ++first) {
+    low = std::min(low, *first);
+    high = std::max(high, *first);
+  }
+  return {low, high};
+}
+
+template <typename T>
+S21_TARGET_AVX2 T accumulateAvx2(const T* first, const T* last, T init) {
+  __m256i sum = _mm256_setzero_si256();
+  for (; last - first >= kLanes<T>; first += kLanes<T>) {
+    sum = add<T>(sum, load(first));
+  }
+  T lanes[kLanes<T>];
+  store(lanes, sum);
+  for (T lane : lanes) init = static_cast<T>(init + lane);
+  for (; first != last; ++first) init = static_cast<T>(init + *first);
+  return init;
+}
+
+/**
+ * @brief Копирует Bytes байт 32-байтными регистрами (остаток - memcpy): так
+ * запись во временный массив и чтение из него не ломают store forwarding.
+ */
+template <std::size_t Bytes>
+S21_TARGET_AVX2 inline void copyBlock(void* dst, const void* src) {
+  std::size_t offset = 0;
+  for (; offset + 32 <= Bytes; offset += 32) {
+    store(static_cast<char*>(dst) + offset,
+          load(static_cast<const char*>(src) + offset));
+  }
+  std::memcpy(static_cast<char*>(dst) + offset,
+              static_cast<const char*>(src) + offset, Bytes - offset);
+}
+
+/**
+ * @brief Поэлементное преобразование блоками по 32 байта.
+ *
+ * Блок копируется во временный массив, поэтому out может совпадать с
+ * входом, а цикл фиксированной длины компилятор разворачивает в
+ * AVX2-инструкции для встроенного функтора op.
+ */
+template <typename In, typename Out, typename Op>
+S21_TARGET_AVX2 void transformAvx2(const In* first, const In* last, Out* out,
+                                   Op& op) {
+  constexpr std::ptrdiff_t kBlock = kLanes<In>;
+  for (; last - first >= kBlock; first += kBlock, out += kBlock) {
+    alignas(32) In in[kBlock];
+    alignas(32) Out result[kBlock];
+    copyBlock<sizeof(in)>(in, first);
+    for (std::ptrdiff_t i = 0; i < kBlock; ++i) result[i] = op(in[i]);
+    copyBlock<sizeof(result)>(out, result);
+  }
+  for (; first != last; ++first, ++out) *out = op(*first);
+}
+
+template <typename In1, typename In2, typename Out, typename Op>
+S21_TARGET_AVX2 void transformAvx2(const In1* first1, const In1* last1,
+                                   const In2* first2, Out* out, Op& op) {
+  constexpr std::ptrdiff_t kBlock = kLanes<In1>;
+  for (; last1 - first1 >= kBlock;
+       first1 += kBlock, first2 += kBlock, out += kBlock) {
+    alignas(32) In1 left[kBlock];
+    alignas(32) In2 right[kBlock];
+    alignas(32) Out result[kBlock];
+    copyBlock<sizeof(left)>(left, first1);
+    copyBlock<sizeof(right)>(right, first2);
+    for (std::ptrdiff_t i = 0; i < kBlock; ++i) {
+      result[i] = op(left[i], right[i]);
+    }
+    copyBlock<sizeof(result)>(out, result);
+  }
+  for (; first1 != last1; ++first1, ++first2, ++out) {
+    *out = op(*first1, *first2);
+  }
+}
+
+#endif  // S21_SIMD_AVX2
+
+}  // namespace detail
+
+/// Присваивает value всем элементам [first, last).
+template <typename T>
+void fill(T* first, T* last, const detail::NonDeducedT<T>& value) {
+#if S21_SIMD_AVX2
+  if constexpr (detail::kVectorizable<T>) {
+    if (has_avx2()) {
+      detail::fillAvx2(first, last, value);
+      return;
+    }
+  }
+#endif
+  std::fill(first, last, value);
+}
+
+/// Указатель на первый элемент, равный value, или last.
+template <typename T>
+T* find(T* first, T* last, const detail::NonDeducedT<T>& value) {
+  using Value = std::remove_cv_t<T>;
+#if S21_SIMD_AVX2
+  if constexpr (detail::kVectorizable<Value>) {
+    if (has_avx2()) {
+      return const_cast<T*>(detail::findAvx2<Value>(first, last, value));
+    }
+  }
+#endif
+  return std::find(first, last, value);
+}
+
+/// Количество элементов, равных value.
+template <typename T>
+std::size_t count(const T* first, const T* last,
+                  const detail::NonDeducedT<T>& value) {
+#if S21_SIMD_AVX2
+  if constexpr (detail::kVectorizable<T>) {
+    if (has_avx2()) return detail::countAvx2<T>(first, last, value);
+  }
+#endif
+  return static_cast<std::size_t>(std::count(first, last, value));
+}
+
+/**
+ * @brief Наименьшее и наибольшее значения диапазона.
+ *
+ * @throw std::invalid_argument Если диапазон пуст.
+ */
+template <typename T>
+std::pair<T, T> minmax(const T* first, const T* last) {
+  if (first == last) {
+    throw std::invalid_argument("simd::minmax: empty range");
+  }
+#if S21_SIMD_AVX2
+  if constexpr (detail::kHasMinMax<T>) {
+    if (has_avx2()) return detail::minmaxAvx2<T>(first, last);
+  }
+#endif
+  auto result = std::minmax_element(first, last);
+  return {*result.first, *result.second};
+}
+
+/// Сумма init и элементов диапазона в типе T.
+template <typename T>
+T accumulate(const T* first, const T* last, detail::NonDeducedT<T> init) {
+#if S21_SIMD_AVX2
+  if constexpr (detail::kVectorizable<T>) {
+    if (has_avx2()) return detail::accumulateAvx2<T>(first, last, init);
+  }
+#endif
+  for (; first != last; ++first) init = static_cast<T>(init + *first);
+  return init;
+}
+
+/**
+ * @brief out[i] = op(first[i]). out может совпадать с first.
+ *
+ * @return Указатель за последним записанным элементом.
+ */
+template <typename In, typename Out, typename UnaryOp>
+Out* transform(const In* first, const In* last, Out* out, UnaryOp op) {
+#if S21_SIMD_AVX2
+  if constexpr (detail::kVectorizable<In> && detail::kVectorizable<Out>) {
+    if (has_avx2()) {
+      detail::transformAvx2(first, last, out, op);
+      return out + (last - first);
+    }
+  }
+#endif
+  return std::transform(first, last, out, op);
+}
+
+/**
+ * @brief out[i] = op(first1[i], first2[i]). out может совпадать с любым из
+ * входов.
+ *
+ * @return Указатель за последним записанным элементом.
+ */
+template <typename In1, typename In2, typename Out, typename BinaryOp>
+Out* transform(const In1* first1, const In1* last1, const In2* first2,
+               Out* out, BinaryOp op) {
+#if S21_SIMD_AVX2
+  if constexpr (detail::kVectorizable<In1> && detail::kVectorizable<In2> &&
+                detail::kVectorizable<Out>) {
+    if (has_avx2()) {
+      detail::transformAvx2(first1, last1, first2, out, op);
+      return out + (last1 - first1);
+    }
+  }
+#endif
+  return std::transform(first1, last1, first2, out, op);
+}
+
+// Перегрузки для контейнеров с data() и size(): s21::vector, s21::array
+
+template <typename Container>
+void fill(Container& c, const typename Container::value_type& value) {
+  simd::fill(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container>
+auto find(Container& c, const typename Container::value_type& value) {
+  return simd::find(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container>
+std::size_t count(Container& c, const typename Container::value_type& value) {
+  return simd::count(c.data(), c.data() + c.size(), value);
+}
+
+template <typename Container>
+auto minmax(Container& c) {
+  return simd::minmax(c.data(), c.data() + c.size());
+}
+
+template <typename Container>
+auto accumulate(Container& c, typename Container::value_type init) {
+  return simd::accumulate(c.data(), c.data() + c.size(), init);
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SIMD_ALGORITHM_H_
@@ -0,0 +1,71 @@
+/**
+ * @file cpufeatures.h
+ * @brief Определение векторных расширений процессора во время выполнения.
+ *
+ * Библиотека собирается без флагов вроде -mavx2, поэтому SSE2 (обязательный
+ * для x86-64) используется всегда, а AVX2-ядра компилируются с атрибутом
+ * target и вызываются, только если процессор их поддерживает. Результат
+ * определения кэшируется; тесты могут отключить расширение, чтобы проверить
+ * запасной путь.
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SIMD_CPUFEATURES_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SIMD_CPUFEATURES_H_
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define S21_SIMD_X86 0
+#endif
+
+#if S21_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_AVX2 1
+#define S21_TARGET_AVX2 __attribute__((target("avx2")))
+#define S21_TARGET_POPCNT __attribute__((target("popcnt")))
+#else
+#define S21_SIMD_AVX2 0
+#define S21_TARGET_AVX2
+#define S21_TARGET_POPCNT
+#endif
+
+namespace s21 {
+namespace simd {
+
+/**
+ * @brief Набор расширений, доступных векторным ядрам.
+ */
+struct CpuFeatures {
+  bool avx2 = false;    ///< Разрешено ли использовать AVX2-ядра.
+  bool popcnt = false;  ///< Есть ли инструкция POPCNT.
+};
+
+/**
+ * @brief Возвращает определенные при первом обращении возможности
+ * процессора.
+ *
+ * Ссылка неконстантная: тесты и бенчмарки могут сбросить флаг, чтобы
+ * принудительно выбрать SSE2 или скалярную реализацию.
+ */
+inline CpuFeatures& cpu_features() {
+  static CpuFeatures features = [] {
+    CpuFeatures detected;
+#if S21_SIMD_AVX2
+    detected.avx2 = __builtin_cpu_supports("avx2");
+    detected.popcnt = __builtin_cpu_supports("popcnt");
+#endif
+    return detected;
+  }();
+  return features;
+}
+
+/// Можно ли сейчас вызывать AVX2-ядра.
+inline bool has_avx2() { return cpu_features().avx2; }
+
+/// Можно ли сейчас вызывать ядра с инструкцией POPCNT.
+inline bool has_popcnt() { return cpu_features().popcnt; }
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SIMD_CPUFEATURES_H_
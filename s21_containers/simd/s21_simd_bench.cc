@@ -0,0 +1,94 @@
+// Микробенчмарки векторизованных алгоритмов (algorithm.h) для int и float:
+// AVX2-ядро, тот же вызов со скалярным путем (cpu_features().avx2 = false) и
+// соответствующий стандартный алгоритм. Данные помещаются в L2, каждое ядро
+// прогоняется многократно, печатается миллиард элементов в секунду.
+//
+// Запуск: ./bench.out [количество элементов]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+#include "algorithm.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+volatile long sink = 0;
+
+template <typename Kernel>
+double Measure(std::size_t size, Kernel kernel) {
+  std::size_t repeats = std::max<std::size_t>(1, (std::size_t{1} << 28) / size);
+  auto start = Clock::now();
+  for (std::size_t i = 0; i < repeats; ++i) kernel();
+  double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  return static_cast<double>(size * repeats) / seconds / 1e9;
+}
+
+template <typename Simd, typename Std>
+void Row(const char *name, std::size_t size, Simd simd, Std standard) {
+  bool avx2 = s21::simd::has_avx2();
+  double vector_rate = avx2 ? Measure(size, simd) : 0;
+  s21::simd::cpu_features().avx2 = false;
+  double scalar_rate = Measure(size, simd);
+  s21::simd::cpu_features().avx2 = avx2;
+  double std_rate = Measure(size, standard);
+  std::printf("  %-22s %10.2f %10.2f %10.2f\n", name, vector_rate,
+              scalar_rate, std_rate);
+}
+
+template <typename T>
+void Suite(const char *type, std::size_t size) {
+  std::vector<T> data(size);
+  for (std::size_t i = 0; i < size; ++i) data[i] = static_cast<T>(i % 1000);
+  std::vector<T> out(size);
+  const T *first = data.data();
+  const T *last = first + size;
+  T missing = static_cast<T>(-1);
+
+  std::printf("%s\n", type);
+  Row("fill", size,
+      [&] { s21::simd::fill(out.data(), out.data() + size, T{3}); },
+      [&] { std::fill(out.begin(), out.end(), T{3}); });
+  Row("find (miss)", size,
+      [&] { sink += s21::simd::find(first, last, missing) - first; },
+      [&] { sink += std::find(first, last, missing) - first; });
+  Row("count", size,
+      [&] { sink += static_cast<long>(s21::simd::count(first, last, T{7})); },
+      [&] { sink += std::count(first, last, T{7}); });
+  Row("minmax", size,
+      [&] { sink += static_cast<long>(s21::simd::minmax(first, last).second); },
+      [&] { sink += static_cast<long>(*std::max_element(first, last)); });
+  Row("accumulate", size,
+      [&] {
+        sink += static_cast<long>(s21::simd::accumulate(first, last, T{}));
+      },
+      [&] { sink += static_cast<long>(std::accumulate(first, last, T{})); });
+  auto scale = [](T x) { return static_cast<T>(x * 3 + 1); };
+  Row("transform x*3+1", size,
+      [&] { s21::simd::transform(first, last, out.data(), scale); },
+      [&] { std::transform(first, last, out.begin(), scale); });
+  Row("transform a+b", size,
+      [&] {
+        s21::simd::transform(first, last, first, out.data(), std::plus<T>());
+      },
+      [&] { std::transform(first, last, first, out.begin(), std::plus<T>()); });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 14;
+
+  std::printf("%zu elements, billion elements/s (avx2: %s)\n", size,
+              s21::simd::has_avx2() ? "yes" : "no");
+  std::printf("  %-22s %10s %10s %10s\n", "kernel", "avx2", "scalar", "std");
+  Suite<int>("int", size);
+  Suite<float>("float", size);
+  return 0;
+}
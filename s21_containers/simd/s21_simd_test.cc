@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../array/s21_array.h"
+#include "../vector/s21_vector.h"
+#include "algorithm.h"
+
+namespace {
+
+// Переключает ядра на скалярный путь на время жизни объекта
+class ScopedAvx2 {
+ public:
+  explicit ScopedAvx2(bool enabled) : saved_(s21::simd::cpu_features().avx2) {
+    s21::simd::cpu_features().avx2 = enabled && saved_;
+  }
+  ~ScopedAvx2() { s21::simd::cpu_features().avx2 = saved_; }
+
+ private:
+  bool saved_;
+};
+
+// Сравнивает ядра со стандартными алгоритмами на длинах с разными хвостами
+template <typename T>
+void CheckAgainstStd() {
+  std::mt19937 rng(7);
+  for (bool avx2 : {true, false}) {
+    ScopedAvx2 mode(avx2);
+    for (std::size_t size : {1, 7, 31, 32, 33, 100, 1000}) {
+      std::vector<T> data(size);
+      for (T& value : data) value = static_cast<T>(rng() % 50);
+      const T* first = data.data();
+      const T* last = first + size;
+      T needle = data[size * 2 / 3];
+
+      EXPECT_EQ(s21::simd::find(first, last, needle),
+                std::find(first, last, needle));
+      EXPECT_EQ(s21::simd::find(first, last, static_cast<T>(99)), last);
+      EXPECT_EQ(s21::simd::count(first, last, needle),
+                static_cast<std::size_t>(std::count(first, last, needle)));
+      auto bounds = std::minmax_element(first, last);
+      EXPECT_EQ(s21::simd::minmax(first, last),
+                std::make_pair(*bounds.first, *bounds.second));
+      auto add = [](T a, T b) { return static_cast<T>(a + b); };
+      EXPECT_EQ(s21::simd::accumulate(first, last, T{1}),
+                std::accumulate(first, last, T{1}, add));
+
+      std::vector<T> twice(size);
+      s21::simd::transform(first, last, twice.data(),
+                           [](T x) { return static_cast<T>(x * 2); });
+      std::vector<T> sum(size);
+      s21::simd::transform(first, last, twice.data(), sum.data(),
+                           std::plus<T>());
+      for (std::size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(sum[i], static_cast<T>(data[i] * 3));
+      }
+
+      s21::simd::fill(data.data(), data.data() + size, static_cast<T>(5));
+      EXPECT_EQ(std::count(first, last, static_cast<T>(5)),
+                static_cast<std::ptrdiff_t>(size));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(simd_algorithm, matches_std_for_arithmetic_types) {
+  CheckAgainstStd<std::int8_t>();
+  CheckAgainstStd<std::uint8_t>();
+  CheckAgainstStd<std::int16_t>();
+  CheckAgainstStd<std::uint16_t>();
+  CheckAgainstStd<int>();
+  CheckAgainstStd<unsigned>();
+  CheckAgainstStd<std::int64_t>();
+  CheckAgainstStd<float>();
+  CheckAgainstStd<double>();
+}
+
+TEST(simd_algorithm, containers_and_float_semantics) {
+  s21::vector<float> vector(100);
+  s21::simd::fill(vector, 0.5f);
+  vector[70] = -0.0f;
+  vector[90] = -3.0f;
+  // -0.0 равен 0.0, как и у std::find
+  EXPECT_EQ(s21::simd::find(vector, 0.0f), vector.begin() + 70);
+  EXPECT_EQ(s21::simd::count(vector, 0.5f), 98U);
+  EXPECT_EQ(s21::simd::minmax(vector), std::make_pair(-3.0f, 0.5f));
+  EXPECT_FLOAT_EQ(s21::simd::accumulate(vector, 1.0f), 47.0f);
+  s21::simd::transform(vector.begin(), vector.end(), vector.begin(),
+                       [](float x) { return x * 4; });
+  EXPECT_FLOAT_EQ(vector[0], 2.0f);
+  EXPECT_FLOAT_EQ(vector[90], -12.0f);
+
+  s21::array<int, 40> array;
+  s21::simd::fill(array, 3);
+  array[39] = 8;
+  EXPECT_EQ(s21::simd::accumulate(array, 0), 39 * 3 + 8);
+  EXPECT_EQ(*s21::simd::find(array, 8), 8);
+  EXPECT_THROW(s21::simd::minmax(vector.begin(), vector.begin()),
+               std::invalid_argument);
+}
+
+TEST(simd_algorithm, transform_changes_width) {
+  std::vector<std::int64_t> wide(37);
+  std::iota(wide.begin(), wide.end(), 250);
+  std::vector<std::uint8_t> narrow(37);
+  s21::simd::transform(wide.data(), wide.data() + wide.size(), narrow.data(),
+                       [](std::int64_t x) { return std::uint8_t(x); });
+  EXPECT_EQ(narrow[0], 250);
+  EXPECT_EQ(narrow[36], 30);
+}
+
+TEST(simd_algorithm, bool_uses_scalar_path) {
+  // В байтовом сложении 256 единиц в каждой дорожке дали бы 0, а для bool
+  // сумма - это «или»
+  constexpr std::size_t kSize = 32 * 256;
+  std::unique_ptr<bool[]> flags(new bool[kSize]);
+  bool* first = flags.get();
+  bool* last = first + kSize;
+  std::fill(first, last, true);
+  EXPECT_TRUE(s21::simd::accumulate(first, last, false));
+  s21::simd::transform(first, last, first, first,
+                       [](bool a, bool b) { return a + b; });
+  EXPECT_EQ(s21::simd::count(first, last, true), kSize);
+}
@@ -0,0 +1,479 @@
+/**
+ * @file s21_small_vector.h
+ * @brief Вектор с буфером на N элементов внутри объекта.
+ *
+ * Класс small_vector повторяет интерфейс s21::vector, но первые N элементов
+ * хранит прямо в объекте, без обращения к куче. Только когда элементов
+ * становится больше N, они переносятся в динамический буфер, дальше вектор
+ * растет как обычно. Подходит для коротких последовательностей, которые
+ * создаются и уничтожаются очень часто.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SMALL_VECTOR_S21_SMALL_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SMALL_VECTOR_S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector_detail.h"
+
+namespace s21 {
+
+/**
+ * @class small_vector
+ * @brief Динамический массив со встроенным буфером на N элементов.
+ *
+ * Итераторы и ссылки становятся недействительными при росте буфера, при
+ * вставке и удалении, а также при перемещении вектора, пока элементы лежат
+ * во встроенном буфере.
+ *
+ * @tparam T Тип элементов.
+ * @tparam N Количество элементов во встроенном буфере.
+ * @tparam Allocator Аллокатор для буфера в куче.
+ */
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class small_vector {
+  static_assert(N > 0, "small_vector needs a non-empty inline buffer");
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  /// Емкость встроенного буфера.
+  static constexpr size_type inline_capacity = N;
+
+  small_vector() : data_(inlineData()) {}
+
+  explicit small_vector(const allocator_type &alloc)
+      : data_(inlineData()), alloc_(alloc) {}
+
+  explicit small_vector(size_type n,
+                        const allocator_type &alloc = allocator_type())
+      : data_(inlineData()), alloc_(alloc) {
+    resize(n);
+  }
+
+  explicit small_vector(std::initializer_list<value_type> const &items,
+                        const allocator_type &alloc = allocator_type())
+      : data_(inlineData()), alloc_(alloc) {
+    insert(cend(), items.begin(), items.end());
+  }
+
+  small_vector(const small_vector &other)
+      : data_(inlineData()),
+        alloc_(AllocTraits::select_on_container_copy_construction(
+            other.alloc_)) {
+    insert(cend(), other.cbegin(), other.cend());
+  }
+
+  /**
+   * @brief Конструктор перемещения.
+   *
+   * Буфер в куче забирается целиком, элементы встроенного буфера
+   * перемещаются по одному.
+   */
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : data_(inlineData()), alloc_(std::move(other.alloc_)) {
+    takeFrom(other);
+  }
+
+  small_vector &operator=(const small_vector &other) {
+    if (this != &other) {
+      clear();
+      if constexpr (AllocTraits::propagate_on_container_copy_assignment::
+                        value) {
+        // Буфер в куче возвращается аллокатору, который его выделил
+        if (alloc_ != other.alloc_) releaseHeap();
+        alloc_ = other.alloc_;
+      }
+      insert(cend(), other.cbegin(), other.cend());
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Перемещающее присваивание.
+   *
+   * Как у s21::vector: если аллокатор не переносится при перемещении и
+   * аллокаторы не равны, буфер other нельзя забрать, и элементы
+   * перемещаются по одному в память своего аллокатора.
+   */
+  small_vector &operator=(small_vector &&other) noexcept(
+      (AllocTraits::propagate_on_container_move_assignment::value ||
+       AllocTraits::is_always_equal::value) &&
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this == &other) return *this;
+    clear();
+    if constexpr (!AllocTraits::propagate_on_container_move_assignment::
+                      value) {
+      if (alloc_ != other.alloc_) {
+        reserve(other.size_);
+        for (; size_ < other.size_; ++size_) {
+          AllocTraits::construct(alloc_, data_ + size_,
+                                 std::move(other.data_[size_]));
+        }
+        other.clear();
+        return *this;
+      }
+    }
+    releaseHeap();
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(other.alloc_);
+    }
+    takeFrom(other);
+    return *this;
+  }
+
+  ~small_vector() {
+    clear();
+    releaseHeap();
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("small_vector::at: index " +
+                              std::to_string(pos) + " >= size " +
+                              std::to_string(size_));
+    }
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+  reference front() { return data_[0]; }
+  const_reference front() const { return data_[0]; }
+  reference back() { return data_[size_ - 1]; }
+  const_reference back() const { return data_[size_ - 1]; }
+  value_type *data() { return data_; }
+  const value_type *data() const { return data_; }
+  allocator_type get_allocator() const { return alloc_; }
+
+  iterator begin() { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + size_; }
+  const_iterator cbegin() const { return data_; }
+  const_iterator cend() const { return data_ + size_; }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return capacity_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  /// Лежат ли элементы во встроенном буфере.
+  bool is_inline() const { return data_ == inlineData(); }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity > capacity_) {
+      relocate(new_capacity);
+    }
+  }
+
+  /**
+   * @brief Освобождает неиспользуемую память.
+   *
+   * Если элементы помещаются во встроенный буфер, они возвращаются в него и
+   * буфер в куче освобождается.
+   */
+  void shrink_to_fit() {
+    if (is_inline() || size_ == capacity_) return;
+    relocate(std::max(size_, N));
+  }
+
+  void clear() {
+    destroyRange(data_, data_ + size_);
+    size_ = 0;
+  }
+
+  void resize(size_type n) {
+    growTo(n, [this](value_type *p) { AllocTraits::construct(alloc_, p); });
+  }
+
+  void resize(size_type n, const_reference value) {
+    value_type copy(value);
+    growTo(n, [this, &copy](value_type *p) {
+      AllocTraits::construct(alloc_, p, copy);
+    });
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      // Аргументы могут ссылаться на элементы: создаем значение до переноса
+      value_type value(std::forward<Args>(args)...);
+      relocate(growCapacity(size_ + 1));
+      AllocTraits::construct(alloc_, data_ + size_, std::move(value));
+    } else {
+      AllocTraits::construct(alloc_, data_ + size_,
+                             std::forward<Args>(args)...);
+    }
+    return data_[size_++];
+  }
+
+  void pop_back() {
+    --size_;
+    AllocTraits::destroy(alloc_, data_ + size_);
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = static_cast<size_type>(pos - data_);
+    if (index == size_) {
+      emplace_back(std::forward<Args>(args)...);
+      return data_ + index;
+    }
+    value_type value(std::forward<Args>(args)...);
+    return insertGap(index, 1, [this, &value](value_type *dst) {
+      AllocTraits::construct(alloc_, dst, std::move(value));
+    });
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    size_type index = static_cast<size_type>(pos - data_);
+    value_type copy(value);
+    return insertGap(index, count, [this, count, &copy](value_type *dst) {
+      size_type built = 0;
+      try {
+        for (; built < count; ++built) {
+          AllocTraits::construct(alloc_, dst + built, copy);
+        }
+      } catch (...) {
+        destroyRange(dst, dst + built);
+        throw;
+      }
+    });
+  }
+
+  /**
+   * @brief Вставляет элементы диапазона [first, last) перед позицией pos.
+   *
+   * Диапазон не должен указывать на элементы самого вектора.
+   */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = static_cast<size_type>(pos - data_);
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      size_type count = static_cast<size_type>(std::distance(first, last));
+      return insertGap(index, count, [this, first, last](value_type *dst) {
+        value_type *out = dst;
+        try {
+          for (InputIt it = first; it != last; ++it, ++out) {
+            AllocTraits::construct(alloc_, out, *it);
+          }
+        } catch (...) {
+          destroyRange(dst, out);
+          throw;
+        }
+      });
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) {
+        emplace_back(*first);
+      }
+      std::rotate(data_ + index, data_ + old_size, data_ + size_);
+      return data_ + index;
+    }
+  }
+
+  /**
+   * @brief Вставляет элементы из аргументов перед позицией pos.
+   *
+   * @return Итератор на позицию за последним вставленным элементом.
+   */
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    if ((vector_detail::isElement(args, data_, data_ + size_) || ...)) {
+      return insert_many(pos, value_type(std::forward<Args>(args))...);
+    }
+    size_type index = static_cast<size_type>(pos - data_);
+    constexpr size_type count = sizeof...(Args);
+    insertGap(index, count, [&](value_type *dst) {
+      vector_detail::constructEach(alloc_, dst, std::forward<Args>(args)...);
+    });
+    return data_ + index + count;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    reserve(size_ + sizeof...(Args));
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  void erase(iterator pos) {
+    std::move(pos + 1, end(), pos);
+    pop_back();
+  }
+
+  /**
+   * @brief Обменивает содержимое двух векторов.
+   *
+   * Буферы в куче обмениваются указателями, встроенные - поэлементно
+   * через перемещающее присваивание. Как и у std::vector, аллокаторы без
+   * propagate_on_container_swap должны быть равны.
+   */
+  void swap(small_vector &other) {
+    if (this == &other) return;
+    if (!is_inline() && !other.is_inline()) {
+      if constexpr (AllocTraits::propagate_on_container_swap::value) {
+        std::swap(alloc_, other.alloc_);
+      }
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      return;
+    }
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  value_type *data_;
+  size_type size_ = 0;
+  size_type capacity_ = N;
+  allocator_type alloc_;
+  alignas(value_type) unsigned char inline_[N * sizeof(value_type)];
+
+  value_type *inlineData() {
+    return reinterpret_cast<value_type *>(inline_);
+  }
+  const value_type *inlineData() const {
+    return reinterpret_cast<const value_type *>(inline_);
+  }
+
+  size_type growCapacity(size_type required) const {
+    return std::max(required, capacity_ * 2);
+  }
+
+  void destroyRange(value_type *first, value_type *last) {
+    vector_detail::destroyRange(alloc_, first, last);
+  }
+
+  void releaseHeap() {
+    if (!is_inline()) {
+      AllocTraits::deallocate(alloc_, data_, capacity_);
+      data_ = inlineData();
+      capacity_ = N;
+    }
+  }
+
+  /// Забирает элементы other, оставляя его пустым и встроенным.
+  void takeFrom(small_vector &other) {
+    if (other.is_inline()) {
+      transfer(other.data_, other.data_ + other.size_, data_);
+      size_ = other.size_;
+      other.clear();
+    } else {
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inlineData();
+      other.size_ = 0;
+      other.capacity_ = N;
+    }
+  }
+
+  /// Переносит [first, last) в неинициализированную память dst
+  /// (vector_detail::transfer).
+  void transfer(value_type *first, value_type *last, value_type *dst) {
+    vector_detail::transfer(alloc_, first, last, dst);
+  }
+
+  /// Переход на буфер емкостью new_capacity (встроенный, если она равна N).
+  void relocate(size_type new_capacity) {
+    value_type *tmp = new_capacity == N && !is_inline()
+                          ? inlineData()
+                          : AllocTraits::allocate(alloc_, new_capacity);
+    try {
+      transfer(data_, data_ + size_, tmp);
+    } catch (...) {
+      if (tmp != inlineData()) {
+        AllocTraits::deallocate(alloc_, tmp, new_capacity);
+      }
+      throw;
+    }
+    destroyRange(data_, data_ + size_);
+    releaseHeap();
+    data_ = tmp;
+    capacity_ = new_capacity;
+  }
+
+  template <typename Init>
+  void growTo(size_type n, Init init) {
+    if (n <= size_) {
+      destroyRange(data_ + n, data_ + size_);
+      size_ = n;
+      return;
+    }
+    reserve(n);
+    for (; size_ < n; ++size_) {
+      init(data_ + size_);
+    }
+  }
+
+  /**
+   * @brief Вставляет count элементов перед index, перенося буфер не более
+   * одного раза и сдвигая хвост один раз (общие алгоритмы
+   * s21_vector_detail.h, как у s21::vector).
+   */
+  template <typename Fill>
+  iterator insertGap(size_type index, size_type count, Fill &&fill) {
+    if (count == 0) return data_ + index;
+    if (size_ + count > capacity_) {
+      size_type new_capacity = growCapacity(size_ + count);
+      value_type *tmp = AllocTraits::allocate(alloc_, new_capacity);
+      try {
+        vector_detail::insertRelocating(alloc_, data_, size_, index, count,
+                                        tmp, fill);
+      } catch (...) {
+        AllocTraits::deallocate(alloc_, tmp, new_capacity);
+        throw;
+      }
+      destroyRange(data_, data_ + size_);
+      releaseHeap();
+      data_ = tmp;
+      capacity_ = new_capacity;
+      size_ += count;
+    } else {
+      vector_detail::insertInPlace(alloc_, data_, size_, index, count, fill);
+    }
+    return data_ + index;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SMALL_VECTOR_S21_SMALL_VECTOR_H_
@@ -0,0 +1,70 @@
+// Бенчмарк короткоживущих векторов: s21::small_vector<int, 8> против
+// s21::vector<int> и std::vector<int>. Каждая итерация создает вектор,
+// добавляет в него n элементов и уничтожает его; n берется около емкости
+// встроенного буфера. Глобальный operator new подменен, чтобы считать
+// обращения к куче.
+//
+// Запуск: ./bench.out [количество итераций]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+#include "s21_small_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::size_t allocations = 0;
+
+template <typename Vector>
+void Run(const char *name, std::size_t n, std::size_t iterations) {
+  std::size_t before = allocations;
+  long checksum = 0;
+  auto start = Clock::now();
+  for (std::size_t it = 0; it < iterations; ++it) {
+    Vector vector;
+    for (std::size_t i = 0; i < n; ++i) {
+      vector.push_back(static_cast<int>(i + it));
+    }
+    if (!vector.empty()) checksum += vector.back();
+  }
+  double ns = std::chrono::duration<double, std::nano>(Clock::now() - start)
+                  .count() /
+              static_cast<double>(iterations);
+  double per_iteration = static_cast<double>(allocations - before) /
+                         static_cast<double>(iterations);
+  std::printf("  %-22s %4zu %12.1f %12.2f\n", name, n, ns, per_iteration);
+  if (checksum == 42) std::printf("\n");
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+  ++allocations;
+  if (void *p = std::malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+int main(int argc, char **argv) {
+  std::size_t iterations =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+
+  std::printf("%zu iterations: construct, push_back n ints, destroy\n",
+              iterations);
+  std::printf("  %-22s %4s %12s %12s\n", "container", "n", "ns/iter",
+              "allocs/iter");
+  for (std::size_t n : {1, 4, 7, 8, 9, 16, 32}) {
+    Run<s21::small_vector<int, 8>>("s21::small_vector<8>", n, iterations);
+    Run<s21::vector<int>>("s21::vector", n, iterations);
+    Run<std::vector<int>>("std::vector", n, iterations);
+  }
+  return 0;
+}
@@ -0,0 +1,184 @@
+#include "s21_small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "../test_support/tracking_resource.h"
+
+using s21::test_support::CopyPropagatingAllocator;
+using s21::test_support::TrackingResource;
+
+TEST(small_vector, stays_inline_up_to_n) {
+  s21::small_vector<int, 4> vector;
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 4U);
+  for (int i = 0; i < 4; ++i) {
+    vector.push_back(i);
+  }
+  EXPECT_TRUE(vector.is_inline());
+  vector.push_back(4);
+  // пятый элемент переносит все в кучу
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 8U);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(vector[i], i);
+  }
+  EXPECT_THROW(vector.at(5), std::out_of_range);
+}
+
+TEST(small_vector, matches_std_vector) {
+  s21::small_vector<std::string, 3> s21_vector;
+  std::vector<std::string> std_vector;
+  for (int i = 0; i < 20; ++i) {
+    std::string value(20, static_cast<char>('a' + i));
+    s21_vector.insert(s21_vector.cbegin() + s21_vector.size() / 2, value);
+    std_vector.insert(std_vector.cbegin() + std_vector.size() / 2, value);
+  }
+  s21_vector.erase(s21_vector.begin() + 3);
+  std_vector.erase(std_vector.begin() + 3);
+  s21_vector.insert(s21_vector.cbegin() + 1, 4, "x");
+  std_vector.insert(std_vector.cbegin() + 1, 4, "x");
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (std::size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+}
+
+TEST(small_vector, insert_many) {
+  s21::small_vector<int, 4> vector{1, 5};
+  auto it = vector.insert_many(vector.cbegin() + 1, 2, 3, 4);
+  EXPECT_EQ(it, vector.begin() + 4);
+  vector.insert_many_back(6, 7);
+  // аргумент-ссылка на элемент, который сдвигается вставкой
+  vector.insert_many(vector.cbegin(), vector[0]);
+  std::vector<int> expected{1, 1, 2, 3, 4, 5, 6, 7};
+  EXPECT_TRUE(std::equal(vector.begin(), vector.end(), expected.begin(),
+                         expected.end()));
+  // пустой набор аргументов ничего не вставляет
+  EXPECT_EQ(vector.insert_many(vector.cbegin() + 2), vector.begin() + 2);
+  EXPECT_EQ(vector.size(), 8U);
+  std::forward_list<int> list{8, 9};
+  vector.insert(vector.cend(), list.begin(), list.end());
+  EXPECT_EQ(vector.size(), 10U);
+  EXPECT_EQ(vector.back(), 9);
+}
+
+TEST(small_vector, copy_and_move) {
+  s21::small_vector<std::string, 2> small{"a", "b"};
+  s21::small_vector<std::string, 2> large{"a", "b", "c"};
+  const std::string *heap = large.data();
+
+  s21::small_vector<std::string, 2> copy(large);
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(copy[2], "c");
+
+  s21::small_vector<std::string, 2> moved_small(std::move(small));
+  EXPECT_TRUE(moved_small.is_inline());
+  EXPECT_EQ(moved_small[1], "b");
+  EXPECT_TRUE(small.empty());
+
+  // буфер в куче переходит без копирования элементов
+  s21::small_vector<std::string, 2> moved_large(std::move(large));
+  EXPECT_EQ(moved_large.data(), heap);
+  EXPECT_TRUE(large.empty());
+  EXPECT_TRUE(large.is_inline());
+
+  moved_small = std::move(moved_large);
+  EXPECT_EQ(moved_small.data(), heap);
+  moved_large = copy;
+  EXPECT_EQ(moved_large[0], "a");
+  EXPECT_EQ(moved_large.size(), 3U);
+}
+
+TEST(small_vector, swap_inline_with_heap) {
+  s21::small_vector<std::unique_ptr<int>, 2> inline_vector;
+  inline_vector.push_back(std::make_unique<int>(1));
+  s21::small_vector<std::unique_ptr<int>, 2> heap_vector;
+  for (int i = 0; i < 3; ++i) {
+    heap_vector.push_back(std::make_unique<int>(10 + i));
+  }
+  inline_vector.swap(heap_vector);
+  EXPECT_FALSE(inline_vector.is_inline());
+  EXPECT_TRUE(heap_vector.is_inline());
+  EXPECT_EQ(*inline_vector[2], 12);
+  EXPECT_EQ(*heap_vector[0], 1);
+}
+
+TEST(small_vector, reserve_and_shrink_to_fit) {
+  s21::small_vector<std::string, 4> vector{"a", "b"};
+  vector.reserve(3);
+  EXPECT_TRUE(vector.is_inline());
+  vector.reserve(16);
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 16U);
+  vector.resize(6, "z");
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.capacity(), 6U);
+  vector.resize(3);
+  // помещается во встроенный буфер - возвращаемся в него
+  vector.shrink_to_fit();
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 4U);
+  EXPECT_EQ(vector[0], "a");
+  EXPECT_EQ(vector[2], "z");
+}
+
+TEST(small_vector, move_between_unequal_allocators) {
+  using Allocator = std::pmr::polymorphic_allocator<int>;
+  using Vector = s21::small_vector<int, 2, Allocator>;
+  TrackingResource first, second;
+  {
+    Vector target{Allocator(&first)};
+    Vector heap{Allocator(&second)};
+    for (int i = 0; i < 10; ++i) {
+      target.push_back(i);
+      heap.push_back(-i);
+    }
+    // polymorphic_allocator не переносится: буфер second остается у него
+    target = std::move(heap);
+    EXPECT_EQ(target.size(), 10U);
+    EXPECT_EQ(target[9], -9);
+    EXPECT_EQ(target.get_allocator().resource(), &first);
+
+    Vector inline_vector{Allocator(&first)};
+    inline_vector.push_back(7);
+    Vector other{Allocator(&first)};
+    for (int i = 0; i < 5; ++i) other.push_back(i);
+    inline_vector.swap(other);
+    EXPECT_EQ(inline_vector.size(), 5U);
+    EXPECT_EQ(other.size(), 1U);
+    EXPECT_EQ(other[0], 7);
+  }
+  EXPECT_EQ(first.foreign, 0);
+  EXPECT_EQ(second.foreign, 0);
+  EXPECT_TRUE(first.live.empty());
+  EXPECT_TRUE(second.live.empty());
+}
+
+TEST(small_vector, copy_assignment_propagates_allocator) {
+  using Allocator = CopyPropagatingAllocator<int>;
+  using Vector = s21::small_vector<int, 2, Allocator>;
+  TrackingResource first, second;
+  {
+    Vector target{Allocator(&first)};
+    Vector source{Allocator(&second)};
+    for (int i = 0; i < 10; ++i) {
+      target.push_back(i);
+      source.push_back(-i);
+    }
+    // буфер target возвращается в first, новый берется из second
+    target = source;
+    EXPECT_TRUE(first.live.empty());
+    EXPECT_EQ(target.get_allocator().resource, &second);
+    EXPECT_EQ(target.size(), 10U);
+    EXPECT_EQ(target[9], -9);
+  }
+  EXPECT_EQ(first.foreign, 0);
+  EXPECT_EQ(second.foreign, 0);
+  EXPECT_TRUE(second.live.empty());
+}
@@ -0,0 +1,404 @@
+/**
+ * @file s21_soa_vector.h
+ * @brief Вектор записей, хранящий каждое поле в отдельном массиве
+ * (structure of arrays).
+ *
+ * Класс soa_vector<Fields...> держит по s21::vector на каждое поле записи.
+ * Проход по одному полю читает только его массив, без остальных полей
+ * записей, и векторизуется компилятором или алгоритмами s21::simd через
+ * column<I>(). Запись целиком добавляется push_back/emplace_back, а доступ
+ * к строке дает прокси-ссылка с методом get<I>().
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SOA_VECTOR_S21_SOA_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SOA_VECTOR_S21_SOA_VECTOR_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/**
+ * @class column_span
+ * @brief Непрерывный диапазон элементов одного поля soa_vector.
+ *
+ * Действителен, пока soa_vector не перевыделяет память (push_back сверх
+ * емкости, reserve, resize).
+ *
+ * @tparam T Тип поля, для чтения - const T.
+ */
+template <typename T>
+class column_span {
+ public:
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using reference = T &;
+  using iterator = T *;
+
+  column_span() = default;
+  column_span(T *data, size_type size) : data_(data), size_(size) {}
+
+  T *data() const { return data_; }
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  reference operator[](size_type pos) const { return data_[pos]; }
+  iterator begin() const { return data_; }
+  iterator end() const { return data_ + size_; }
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+/**
+ * @class soa_vector
+ * @brief Динамический массив записей с поколоночным хранением полей.
+ *
+ * @tparam Fields Типы полей записи.
+ */
+template <typename... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+  using Columns = std::tuple<s21::vector<Fields>...>;
+  using Indices = std::index_sequence_for<Fields...>;
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  /// Тип поля с номером I.
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  /// Количество полей записи.
+  static constexpr size_type field_count = sizeof...(Fields);
+
+  /**
+   * @brief Прокси-ссылка на запись: номер строки и указатель на вектор.
+   *
+   * Присваивание записывает поля в строку вектора, приведение к value_type
+   * копирует их.
+   *
+   * @tparam Const Если true, поля доступны только для чтения.
+   */
+  template <bool Const>
+  class ReferenceBase {
+   public:
+    using OwnerPtr =
+        std::conditional_t<Const, const soa_vector *, soa_vector *>;
+
+    ReferenceBase(OwnerPtr owner, size_type index)
+        : owner_(owner), index_(index) {}
+    // Неконстантная ссылка неявно приводится к константной
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    ReferenceBase(const ReferenceBase<OtherConst> &other)
+        : owner_(other.owner()), index_(other.index()) {}
+
+    ReferenceBase(const ReferenceBase &) = default;
+
+    /// Поле I строки.
+    template <std::size_t I>
+    decltype(auto) get() const {
+      return owner_->template column<I>()[index_];
+    }
+
+    operator value_type() const { return toTuple(Indices()); }
+
+    /// Записывает поля value в строку.
+    const ReferenceBase &operator=(const value_type &value) const {
+      assign(value, Indices());
+      return *this;
+    }
+
+    /// Копирует поля другой строки (как присваивание элемента вектора).
+    const ReferenceBase &operator=(const ReferenceBase &other) const {
+      return *this = static_cast<value_type>(other);
+    }
+
+    bool operator==(const value_type &value) const {
+      return toTuple(Indices()) == value;
+    }
+    bool operator!=(const value_type &value) const {
+      return !(*this == value);
+    }
+
+    OwnerPtr owner() const { return owner_; }
+    size_type index() const { return index_; }
+
+   private:
+    OwnerPtr owner_;
+    size_type index_;
+
+    template <std::size_t... I>
+    value_type toTuple(std::index_sequence<I...>) const {
+      return value_type(get<I>()...);
+    }
+
+    template <std::size_t... I>
+    void assign(const value_type &value, std::index_sequence<I...>) const {
+      ((get<I>() = std::get<I>(value)), ...);
+    }
+  };
+
+  using reference = ReferenceBase<false>;
+  using const_reference = ReferenceBase<true>;
+
+  /**
+   * @brief Итератор по строкам; разыменование возвращает прокси-ссылку.
+   *
+   * Как и у std::vector<bool>, ссылка - не настоящая T&, поэтому
+   * алгоритмы, которым нужны адреса элементов, с ним не работают.
+   */
+  template <bool Const>
+  class IteratorBase {
+   public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = soa_vector::value_type;
+    using reference = ReferenceBase<Const>;
+    using pointer = void;
+    using iterator_category = std::random_access_iterator_tag;
+    using OwnerPtr = typename reference::OwnerPtr;
+
+    IteratorBase() = default;
+    IteratorBase(OwnerPtr owner, size_type index)
+        : owner_(owner), index_(index) {}
+    template <bool OtherConst,
+              typename = std::enable_if_t<Const && !OtherConst>>
+    IteratorBase(const IteratorBase<OtherConst> &other)
+        : owner_(other.owner()), index_(other.index()) {}
+
+    reference operator*() const { return reference(owner_, index_); }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    IteratorBase &operator++() {
+      ++index_;
+      return *this;
+    }
+    IteratorBase operator++(int) {
+      IteratorBase tmp = *this;
+      ++index_;
+      return tmp;
+    }
+    IteratorBase &operator--() {
+      --index_;
+      return *this;
+    }
+    IteratorBase operator--(int) {
+      IteratorBase tmp = *this;
+      --index_;
+      return tmp;
+    }
+    IteratorBase &operator+=(difference_type n) {
+      index_ = static_cast<size_type>(static_cast<difference_type>(index_) +
+                                      n);
+      return *this;
+    }
+    IteratorBase &operator-=(difference_type n) { return *this += -n; }
+    friend IteratorBase operator+(IteratorBase it, difference_type n) {
+      return it += n;
+    }
+    friend IteratorBase operator+(difference_type n, IteratorBase it) {
+      return it += n;
+    }
+    friend IteratorBase operator-(IteratorBase it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const IteratorBase &a,
+                                     const IteratorBase &b) {
+      return static_cast<difference_type>(a.index_) -
+             static_cast<difference_type>(b.index_);
+    }
+
+    bool operator==(const IteratorBase &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const IteratorBase &other) const {
+      return index_ != other.index_;
+    }
+    bool operator<(const IteratorBase &other) const {
+      return index_ < other.index_;
+    }
+    bool operator>(const IteratorBase &other) const {
+      return index_ > other.index_;
+    }
+    bool operator<=(const IteratorBase &other) const {
+      return index_ <= other.index_;
+    }
+    bool operator>=(const IteratorBase &other) const {
+      return index_ >= other.index_;
+    }
+
+    OwnerPtr owner() const { return owner_; }
+    size_type index() const { return index_; }
+
+   private:
+    OwnerPtr owner_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  using iterator = IteratorBase<false>;
+  using const_iterator = IteratorBase<true>;
+
+  soa_vector() = default;
+
+  explicit soa_vector(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const value_type &item : items) {
+      push_back(item);
+    }
+  }
+
+  reference at(size_type pos) {
+    checkIndex(pos);
+    return reference(this, pos);
+  }
+
+  const_reference at(size_type pos) const {
+    checkIndex(pos);
+    return const_reference(this, pos);
+  }
+
+  reference operator[](size_type pos) { return reference(this, pos); }
+  const_reference operator[](size_type pos) const {
+    return const_reference(this, pos);
+  }
+  reference front() { return reference(this, 0); }
+  const_reference front() const { return const_reference(this, 0); }
+  reference back() { return reference(this, size_ - 1); }
+  const_reference back() const { return const_reference(this, size_ - 1); }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cbegin() const { return const_iterator(this, 0); }
+  const_iterator cend() const { return const_iterator(this, size_); }
+
+  /// Все значения поля I подряд в памяти.
+  template <std::size_t I>
+  column_span<field_type<I>> column() {
+    return {std::get<I>(columns_).data(), size_};
+  }
+
+  template <std::size_t I>
+  column_span<const field_type<I>> column() const {
+    return {std::get<I>(columns_).data(), size_};
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+  void reserve(size_type new_capacity) {
+    std::apply([new_capacity](auto &...c) { (c.reserve(new_capacity), ...); },
+               columns_);
+  }
+
+  void shrink_to_fit() {
+    std::apply([](auto &...c) { (c.shrink_to_fit(), ...); }, columns_);
+  }
+
+  void clear() {
+    std::apply([](auto &...c) { (c.clear(), ...); }, columns_);
+    size_ = 0;
+  }
+
+  /**
+   * @brief Меняет число записей; новые поля создаются по умолчанию.
+   *
+   * Если одна из колонок бросила исключение, уже измененные колонки
+   * возвращаются к прежнему размеру.
+   */
+  void resize(size_type n) {
+    forColumns(Indices(), [n](auto &c) { c.resize(n); });
+    size_ = n;
+  }
+
+  void push_back(const value_type &value) {
+    std::apply([this](const Fields &...fields) { emplace_back(fields...); },
+               value);
+  }
+
+  void push_back(value_type &&value) {
+    std::apply(
+        [this](Fields &...fields) { emplace_back(std::move(fields)...); },
+        value);
+  }
+
+  /**
+   * @brief Добавляет запись, создавая каждое поле из своего аргумента.
+   *
+   * Если создание поля бросило исключение, поля, уже добавленные в другие
+   * колонки, удаляются, и вектор остается прежним.
+   */
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields),
+                  "soa_vector::emplace_back takes one argument per field");
+    appendFields(Indices(), std::forward<Args>(args)...);
+    return reference(this, size_++);
+  }
+
+  void pop_back() {
+    std::apply([](auto &...c) { (c.pop_back(), ...); }, columns_);
+    --size_;
+  }
+
+  void swap(soa_vector &other) {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  Columns columns_;
+  size_type size_ = 0;
+
+  void checkIndex(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("soa_vector::at: index " + std::to_string(pos) +
+                              " >= size " + std::to_string(size_));
+    }
+  }
+
+  template <std::size_t... I, typename... Args>
+  void appendFields(std::index_sequence<I...>, Args &&...args) {
+    size_type done = 0;
+    try {
+      ((std::get<I>(columns_).emplace_back(std::forward<Args>(args)), ++done),
+       ...);
+    } catch (...) {
+      ((I < done ? std::get<I>(columns_).pop_back() : void()), ...);
+      throw;
+    }
+  }
+
+  /**
+   * @brief Применяет op к колонкам по порядку, при исключении откатывает
+   * размер. Колонка, на которой op бросил исключение, тоже откатывается:
+   * s21::vector::resize оставляет уже созданные элементы.
+   */
+  template <std::size_t... I, typename Op>
+  void forColumns(std::index_sequence<I...>, Op op) {
+    try {
+      (op(std::get<I>(columns_)), ...);
+    } catch (...) {
+      (std::get<I>(columns_).resize(size_), ...);
+      throw;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_SOA_VECTOR_S21_SOA_VECTOR_H_
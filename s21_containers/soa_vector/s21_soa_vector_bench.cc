@@ -0,0 +1,103 @@
+// Бенчмарк проходов по одному и двум полям 64-байтной записи: массив
+// структур s21::vector<Record> против s21::soa_vector с теми же полями.
+// Печатается лучшее время прохода из нескольких повторов в миллисекундах.
+//
+// Запуск: ./bench.out [количество записей]
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../simd/algorithm.h"
+#include "../vector/s21_vector.h"
+#include "s21_soa_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Name = std::array<char, 40>;
+
+struct Record {
+  long id;
+  double price;
+  int quantity;
+  int flags;
+  Name name;
+};
+
+template <typename Scan>
+double BestMs(Scan scan) {
+  double best = 1e30;
+  double sink = 0;
+  for (int repeat = 0; repeat < 7; ++repeat) {
+    auto start = Clock::now();
+    sink += scan();
+    best = std::min(best, std::chrono::duration<double, std::milli>(
+                              Clock::now() - start)
+                              .count());
+  }
+  if (sink == 42) std::printf("\n");  // не дает выбросить проходы
+  return best;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+
+  s21::vector<Record> aos;
+  s21::soa_vector<long, double, int, int, Name> soa;
+  aos.reserve(size);
+  soa.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    Record record{static_cast<long>(i), static_cast<double>(i % 1000) * 0.5,
+                  static_cast<int>(i % 7), 0, Name{}};
+    aos.push_back(record);
+    soa.emplace_back(record.id, record.price, record.quantity, record.flags,
+                     record.name);
+  }
+
+  std::printf("%zu records of %zu bytes, best scan in ms\n", size,
+              sizeof(Record));
+  std::printf("  %-34s %10s %10s\n", "scan", "AoS", "SoA");
+  double aos_sum = BestMs([&] {
+    double sum = 0;
+    for (std::size_t i = 0; i < size; ++i) sum += aos[i].price;
+    return sum;
+  });
+  double soa_sum = BestMs([&] {
+    double sum = 0;
+    for (double price : soa.column<1>()) sum += price;
+    return sum;
+  });
+  std::printf("  %-34s %10.2f %10.2f\n", "sum(price)", aos_sum, soa_sum);
+
+  double soa_simd = BestMs([&] {
+    auto prices = soa.column<1>();
+    return s21::simd::accumulate(prices, 0.0);
+  });
+  std::printf("  %-34s %10s %10.2f\n", "sum(price), s21::simd::accumulate",
+              "-", soa_simd);
+
+  double aos_two = BestMs([&] {
+    double sum = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      sum += aos[i].price * aos[i].quantity;
+    }
+    return sum;
+  });
+  double soa_two = BestMs([&] {
+    auto prices = soa.column<1>();
+    auto quantities = soa.column<2>();
+    double sum = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      sum += prices[i] * quantities[i];
+    }
+    return sum;
+  });
+  std::printf("  %-34s %10.2f %10.2f\n", "sum(price * quantity)", aos_two,
+              soa_two);
+  return 0;
+}
@@ -0,0 +1,119 @@
+#include "s21_soa_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "../simd/algorithm.h"
+
+namespace {
+
+// Поле, создание которого бросает исключение, когда countdown доходит до
+// нуля; копирование и перемещение не считаются
+struct Faulty {
+  static int countdown;
+  int value = 0;
+
+  Faulty() { Tick(); }
+  explicit Faulty(int v) : value(v) { Tick(); }
+  Faulty(const Faulty &) = default;
+  Faulty(Faulty &&) noexcept = default;
+  Faulty &operator=(const Faulty &) = default;
+  Faulty &operator=(Faulty &&) noexcept = default;
+
+  static void Tick() {
+    if (--countdown == 0) throw std::runtime_error("faulty field");
+  }
+};
+int Faulty::countdown = 0;
+
+}  // namespace
+
+TEST(soa_vector, stores_fields_in_columns) {
+  s21::soa_vector<int, double, std::string> records;
+  records.emplace_back(1, 1.5, "a");
+  records.push_back(std::make_tuple(2, 2.5, std::string("b")));
+  for (int i = 3; i <= 100; ++i) {
+    records.emplace_back(i, i + 0.5, std::to_string(i));
+  }
+  EXPECT_EQ(records.size(), 100U);
+
+  auto ids = records.column<0>();
+  auto prices = records.column<1>();
+  ASSERT_EQ(ids.size(), 100U);
+  // соседние значения поля лежат подряд
+  EXPECT_EQ(&ids[1], &ids[0] + 1);
+  EXPECT_EQ(std::accumulate(ids.begin(), ids.end(), 0), 5050);
+  EXPECT_DOUBLE_EQ(s21::simd::accumulate(prices, 0.0), 5100.0);
+  EXPECT_EQ(*s21::simd::find(ids, 42), 42);
+
+  const auto &const_records = records;
+  EXPECT_EQ(const_records.column<2>()[1], "b");
+  EXPECT_THROW(records.at(100), std::out_of_range);
+}
+
+TEST(soa_vector, proxy_reference) {
+  s21::soa_vector<int, std::string> records{{3, "c"}, {1, "a"}, {2, "b"}};
+  auto row = records[1];
+  EXPECT_EQ(row.get<0>(), 1);
+  row.get<1>() = "changed";
+  EXPECT_EQ(records.column<1>()[1], "changed");
+
+  std::tuple<int, std::string> copy = records.front();
+  EXPECT_EQ(copy, std::make_tuple(3, std::string("c")));
+  records.back() = std::make_tuple(7, std::string("g"));
+  EXPECT_TRUE(records[2] == std::make_tuple(7, std::string("g")));
+  records[0] = records[2];
+  EXPECT_EQ(records.at(0).get<1>(), "g");
+
+  int sum = 0;
+  for (auto record : records) sum += record.get<0>();
+  EXPECT_EQ(sum, 15);
+  EXPECT_EQ(records.end() - records.begin(), 3);
+  EXPECT_TRUE(records.end() > records.begin());
+  EXPECT_TRUE(records.begin() <= records.begin());
+  EXPECT_TRUE(records.end() >= records.begin() + 3);
+
+  records.pop_back();
+  records.resize(4);
+  EXPECT_EQ(records.size(), 4U);
+  EXPECT_EQ(records[3].get<0>(), 0);
+  records.clear();
+  EXPECT_TRUE(records.empty());
+}
+
+TEST(soa_vector, throwing_field_leaves_columns_unchanged) {
+  s21::soa_vector<int, Faulty, std::string> records;
+  for (int i = 0; i < 5; ++i) records.emplace_back(i, i, std::to_string(i));
+  auto expect_unchanged = [&records] {
+    EXPECT_EQ(records.size(), 5U);
+    EXPECT_EQ(records.column<0>().size(), 5U);
+    EXPECT_EQ(records.column<1>().size(), 5U);
+    EXPECT_EQ(records.column<2>().size(), 5U);
+  };
+
+  // колонка int уже получила поле, когда Faulty бросил исключение
+  Faulty::countdown = 1;
+  EXPECT_THROW(records.emplace_back(99, 99, "x"), std::runtime_error);
+  expect_unchanged();
+  // колонка int уже выросла до 8, когда Faulty бросил на втором поле
+  Faulty::countdown = 2;
+  EXPECT_THROW(records.resize(8), std::runtime_error);
+  expect_unchanged();
+
+  // следующая запись попадает в одну строку всех колонок: лишних полей
+  // после отката не осталось
+  Faulty::countdown = 0;
+  records.emplace_back(5, 5, "5");
+  records.resize(7);
+  EXPECT_EQ(records.size(), 7U);
+  EXPECT_EQ(records.column<0>()[5], 5);
+  EXPECT_EQ(records.column<1>()[5].value, 5);
+  EXPECT_EQ(records.column<2>()[5], "5");
+  EXPECT_EQ(records.column<0>()[6], 0);
+  EXPECT_EQ(records.column<2>()[6], "");
+}
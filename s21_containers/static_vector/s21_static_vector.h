@@ -0,0 +1,408 @@
+/**
+ * @file s21_static_vector.h
+ * @brief Вектор с емкостью, заданной на этапе компиляции.
+ *
+ * Класс static_vector повторяет интерфейс s21::vector, но все N элементов
+ * хранит прямо в объекте и никогда не обращается к куче. Память под
+ * элементы не инициализируется: создание пустого вектора стоит одной
+ * записи размера. Попытка превысить емкость N бросает std::length_error,
+ * вектор при этом не меняется.
+ *
+ * Для тривиально копируемых T static_vector тоже тривиально копируемый:
+ * его можно копировать memcpy и передавать через границы, где ожидаются
+ * простые данные (например, в буферы разбора пакетов).
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_STATIC_VECTOR_S21_STATIC_VECTOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_STATIC_VECTOR_S21_STATIC_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../array/s21_array.h"
+#include "../vector/s21_vector_detail.h"
+
+namespace s21 {
+
+namespace static_vector_detail {
+
+/// Размер и неинициализированная память под N элементов.
+template <typename T, std::size_t N>
+struct Storage {
+  std::size_t size_ = 0;
+  alignas(T) unsigned char bytes_[N * sizeof(T)];
+
+  T *items() { return reinterpret_cast<T *>(bytes_); }
+  const T *items() const { return reinterpret_cast<const T *>(bytes_); }
+
+  void destroyFrom(std::size_t first) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (std::size_t i = first; i < size_; ++i) items()[i].~T();
+    }
+    size_ = std::min(size_, first);
+  }
+};
+
+/**
+ * @brief Копирование, перемещение и разрушение элементов. Для тривиально
+ * копируемых T все специальные методы неявные и тривиальные.
+ */
+template <typename T, std::size_t N,
+          bool Trivial = std::is_trivially_copyable_v<T>>
+struct Base : Storage<T, N> {};
+
+template <typename T, std::size_t N>
+struct Base<T, N, false> : Storage<T, N> {
+  Base() = default;
+
+  Base(const Base &other) {
+    for (; this->size_ < other.size_; ++this->size_) {
+      ::new (static_cast<void *>(this->items() + this->size_))
+          T(other.items()[this->size_]);
+    }
+  }
+
+  /// Элементы other перемещаются по одному; other сохраняет размер.
+  Base(Base &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    for (; this->size_ < other.size_; ++this->size_) {
+      ::new (static_cast<void *>(this->items() + this->size_))
+          T(std::move(other.items()[this->size_]));
+    }
+  }
+
+  Base &operator=(const Base &other) {
+    if (this != &other) assignFrom(other.items(), other.size_);
+    return *this;
+  }
+
+  Base &operator=(Base &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>) {
+    if (this != &other) {
+      assignFrom(std::make_move_iterator(other.items()), other.size_);
+    }
+    return *this;
+  }
+
+  ~Base() { this->destroyFrom(0); }
+
+ private:
+  /// Присваивает общую часть, недостающее создает, лишнее разрушает.
+  template <typename It>
+  void assignFrom(It source, std::size_t count) {
+    std::size_t common = std::min(this->size_, count);
+    for (std::size_t i = 0; i < common; ++i, ++source) {
+      this->items()[i] = *source;
+    }
+    this->destroyFrom(count);
+    for (; this->size_ < count; ++this->size_, ++source) {
+      ::new (static_cast<void *>(this->items() + this->size_)) T(*source);
+    }
+  }
+};
+
+}  // namespace static_vector_detail
+
+/**
+ * @class static_vector
+ * @brief Динамический массив фиксированной емкости без выделения памяти.
+ *
+ * Итераторы и ссылки остаются действительными, пока соответствующий
+ * элемент не сдвинут вставкой или удалением: буфер никогда не переносится.
+ *
+ * @tparam T Тип элементов.
+ * @tparam N Наибольшее количество элементов.
+ */
+template <typename T, std::size_t N>
+class static_vector : private static_vector_detail::Base<T, N> {
+  static_assert(N > 0, "static_vector needs a non-zero capacity");
+  using Base = static_vector_detail::Base<T, N>;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  static_vector() = default;
+
+  explicit static_vector(size_type n) { resize(n); }
+
+  static_vector(size_type n, const_reference value) { resize(n, value); }
+
+  explicit static_vector(std::initializer_list<value_type> const &items) {
+    insert(cend(), items.begin(), items.end());
+  }
+
+  /// Копирует элементы массива s21::array, помещающегося в емкость.
+  template <std::size_t S, typename Layout>
+  explicit static_vector(const array<T, S, Layout> &items) {
+    static_assert(S <= N, "static_vector: array does not fit");
+    insert(cend(), items.begin(), items.end());
+  }
+
+  reference at(size_type pos) {
+    checkIndex(pos);
+    return data()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    checkIndex(pos);
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) { return data()[pos]; }
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+  reference front() { return data()[0]; }
+  const_reference front() const { return data()[0]; }
+  reference back() { return data()[this->size_ - 1]; }
+  const_reference back() const { return data()[this->size_ - 1]; }
+  value_type *data() { return this->items(); }
+  const value_type *data() const { return this->items(); }
+
+  iterator begin() { return data(); }
+  iterator end() { return data() + this->size_; }
+  const_iterator begin() const { return data(); }
+  const_iterator end() const { return data() + this->size_; }
+  const_iterator cbegin() const { return data(); }
+  const_iterator cend() const { return data() + this->size_; }
+
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == N; }
+  size_type size() const { return this->size_; }
+  static constexpr size_type capacity() { return N; }
+  static constexpr size_type max_size() { return N; }
+
+  /// Ничего не выделяет; бросает std::length_error, если n больше N.
+  void reserve(size_type n) { checkCapacity(n); }
+  void shrink_to_fit() {}
+
+  void clear() { this->destroyFrom(0); }
+
+  void resize(size_type n) {
+    growTo(n, [](value_type *p) { ::new (static_cast<void *>(p)) T(); });
+  }
+
+  void resize(size_type n, const_reference value) {
+    value_type copy(value);
+    growTo(n, [&copy](value_type *p) {
+      ::new (static_cast<void *>(p)) T(copy);
+    });
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    checkCapacity(this->size_ + 1);
+    ::new (static_cast<void *>(end())) T(std::forward<Args>(args)...);
+    return data()[this->size_++];
+  }
+
+  void pop_back() { this->destroyFrom(this->size_ - 1); }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = static_cast<size_type>(pos - data());
+    if (index == this->size_) {
+      emplace_back(std::forward<Args>(args)...);
+      return data() + index;
+    }
+    // Аргументы могут ссылаться на сдвигаемые элементы
+    value_type value(std::forward<Args>(args)...);
+    return insertGap(index, 1, [&value](value_type *dst) {
+      ::new (static_cast<void *>(dst)) T(std::move(value));
+    });
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    size_type index = static_cast<size_type>(pos - data());
+    value_type copy(value);
+    return insertGap(index, count, [count, &copy](value_type *dst) {
+      size_type built = 0;
+      try {
+        for (; built < count; ++built) {
+          ::new (static_cast<void *>(dst + built)) T(copy);
+        }
+      } catch (...) {
+        destroyRange(dst, dst + built);
+        throw;
+      }
+    });
+  }
+
+  /**
+   * @brief Вставляет элементы диапазона [first, last) перед позицией pos.
+   *
+   * Диапазон не должен указывать на элементы самого вектора. Если элементы
+   * не помещаются, бросается std::length_error; у однопроходных итераторов
+   * к этому моменту часть элементов уже добавлена в конец и удаляется.
+   */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = static_cast<size_type>(pos - data());
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      size_type count = static_cast<size_type>(std::distance(first, last));
+      return insertGap(index, count, [first, last](value_type *dst) {
+        value_type *out = dst;
+        try {
+          for (InputIt it = first; it != last; ++it, ++out) {
+            ::new (static_cast<void *>(out)) T(*it);
+          }
+        } catch (...) {
+          destroyRange(dst, out);
+          throw;
+        }
+      });
+    } else {
+      size_type old_size = this->size_;
+      try {
+        for (; first != last; ++first) {
+          emplace_back(*first);
+        }
+      } catch (...) {
+        this->destroyFrom(old_size);
+        throw;
+      }
+      std::rotate(data() + index, data() + old_size, end());
+      return data() + index;
+    }
+  }
+
+  /**
+   * @brief Вставляет элементы из аргументов перед позицией pos.
+   *
+   * @return Итератор на позицию за последним вставленным элементом.
+   */
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    if ((vector_detail::isElement(args, data(), end()) || ...)) {
+      return insert_many(pos, value_type(std::forward<Args>(args))...);
+    }
+    size_type index = static_cast<size_type>(pos - data());
+    constexpr size_type count = sizeof...(Args);
+    insertGap(index, count, [&](value_type *dst) {
+      Placement placement;
+      vector_detail::constructEach(placement, dst, std::forward<Args>(args)...);
+    });
+    return data() + index + count;
+  }
+
+  /// Добавляет элементы в конец; если все не помещаются, ничего не меняет.
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    checkCapacity(this->size_ + sizeof...(Args));
+    (emplace_back(std::forward<Args>(args)), ...);
+  }
+
+  void erase(iterator pos) {
+    std::move(pos + 1, end(), pos);
+    pop_back();
+  }
+
+  /**
+   * @brief Обменивает содержимое двух векторов: общая часть поэлементно,
+   * остаток длинного перемещается в короткий.
+   */
+  void swap(static_vector &other) {
+    if (this == &other) return;
+    static_vector &longer = size() >= other.size() ? *this : other;
+    static_vector &shorter = size() >= other.size() ? other : *this;
+    size_type common = shorter.size();
+    for (size_type i = 0; i < common; ++i) {
+      using std::swap;
+      swap(longer[i], shorter[i]);
+    }
+    for (size_type i = common; i < longer.size(); ++i) {
+      shorter.emplace_back(std::move(longer[i]));
+    }
+    longer.destroyFrom(common);
+  }
+
+  bool operator==(const static_vector &other) const {
+    return std::equal(cbegin(), cend(), other.cbegin(), other.cend());
+  }
+  bool operator!=(const static_vector &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  // Для общих алгоритмов s21_vector_detail.h: std::allocator создает
+  // элементы placement new и уничтожает вызовом деструктора
+  using Placement = std::allocator<value_type>;
+
+  static void destroyRange(value_type *first, value_type *last) {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (; first != last; ++first) first->~T();
+    }
+  }
+
+  void checkIndex(size_type pos) const {
+    if (pos >= this->size_) {
+      throw std::out_of_range("static_vector::at: index " +
+                              std::to_string(pos) + " >= size " +
+                              std::to_string(this->size_));
+    }
+  }
+
+  static void checkCapacity(size_type required) {
+    if (required > N) {
+      throw std::length_error("static_vector: " + std::to_string(required) +
+                              " elements exceed capacity " +
+                              std::to_string(N));
+    }
+  }
+
+  template <typename Init>
+  void growTo(size_type n, Init init) {
+    if (n <= this->size_) {
+      this->destroyFrom(n);
+      return;
+    }
+    checkCapacity(n);
+    for (; this->size_ < n; ++this->size_) {
+      init(end());
+    }
+  }
+
+  /**
+   * @brief Вставляет count элементов перед index, сдвигая хвост один раз
+   * (vector_detail::insertInPlace, как у s21::vector без переноса буфера).
+   */
+  template <typename Fill>
+  iterator insertGap(size_type index, size_type count, Fill &&fill) {
+    if (count == 0) return data() + index;
+    checkCapacity(this->size_ + count);
+    Placement placement;
+    vector_detail::insertInPlace(placement, data(), this->size_, index, count,
+                                 fill);
+    return data() + index;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_STATIC_VECTOR_S21_STATIC_VECTOR_H_
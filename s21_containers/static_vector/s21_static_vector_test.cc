@@ -0,0 +1,79 @@
+#include "s21_static_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <forward_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST(static_vector, overflow_throws_and_keeps_contents) {
+  s21::static_vector<int, 4> vector{1, 2, 3};
+  EXPECT_EQ(vector.capacity(), 4U);
+  vector.push_back(4);
+  EXPECT_TRUE(vector.full());
+  EXPECT_THROW(vector.push_back(5), std::length_error);
+  EXPECT_THROW(vector.insert(vector.cbegin(), 2, 0), std::length_error);
+  EXPECT_THROW(vector.insert_many_back(5, 6), std::length_error);
+  EXPECT_THROW(vector.resize(5), std::length_error);
+  EXPECT_THROW(vector.reserve(5), std::length_error);
+  EXPECT_EQ(vector, (s21::static_vector<int, 4>{1, 2, 3, 4}));
+  EXPECT_THROW(vector.at(4), std::out_of_range);
+
+  std::forward_list<int> list{7, 8};
+  vector.pop_back();
+  EXPECT_THROW(vector.insert(vector.cbegin(), list.begin(), list.end()),
+               std::length_error);
+  EXPECT_EQ(vector, (s21::static_vector<int, 4>{1, 2, 3}));
+}
+
+TEST(static_vector, matches_std_vector) {
+  s21::static_vector<std::string, 32> s21_vector;
+  std::vector<std::string> std_vector;
+  for (int i = 0; i < 20; ++i) {
+    std::string value(20, static_cast<char>('a' + i));
+    s21_vector.insert(s21_vector.cbegin() + s21_vector.size() / 2, value);
+    std_vector.insert(std_vector.cbegin() + std_vector.size() / 2, value);
+  }
+  s21_vector.erase(s21_vector.begin() + 3);
+  std_vector.erase(std_vector.begin() + 3);
+  s21_vector.insert(s21_vector.cbegin() + 1, 4, "x");
+  std_vector.insert(std_vector.cbegin() + 1, 4, "x");
+  // аргумент-ссылка на элемент, который сдвигается вставкой
+  s21_vector.insert_many(s21_vector.cbegin(), s21_vector[2], "y");
+  std_vector.insert(std_vector.cbegin(), {std_vector[2], "y"});
+  // пустой набор аргументов ничего не вставляет
+  EXPECT_EQ(s21_vector.insert_many(s21_vector.cbegin() + 1),
+            s21_vector.begin() + 1);
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (std::size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  s21::static_vector<std::string, 32> copy = s21_vector;
+  s21::static_vector<std::string, 32> other{"z"};
+  other.swap(copy);
+  EXPECT_EQ(other, s21_vector);
+  EXPECT_EQ(copy, (s21::static_vector<std::string, 32>{"z"}));
+  copy = other;
+  EXPECT_EQ(copy.back(), std_vector.back());
+  copy.resize(2);
+  EXPECT_EQ(copy.size(), 2U);
+}
+
+TEST(static_vector, trivially_copyable) {
+  using Header = s21::static_vector<unsigned char, 16>;
+  static_assert(std::is_trivially_copyable_v<Header>);
+  static_assert(!std::is_trivially_copyable_v<
+                s21::static_vector<std::string, 4>>);
+
+  s21::array<unsigned char, 3> bytes{0x45, 0x00, 0x54};
+  Header header(bytes);
+  header.push_back(0x01);
+  Header copy;
+  std::memcpy(static_cast<void *>(&copy), &header, sizeof(Header));
+  EXPECT_EQ(copy, header);
+  EXPECT_EQ(copy.size(), 4U);
+  EXPECT_EQ(copy[2], 0x54);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file tracking_resource.h
+ * @brief Ресурс памяти для тестов контейнеров с аллокаторами.
+ *
+ * TrackingResource запоминает выданные блоки: тест проверяет, что контейнер
+ * вернул всю память и не освобождал чужие блоки через свой аллокатор.
+ * CopyPropagatingAllocator берет память из такого ресурса и, в отличие от
+ * std::pmr::polymorphic_allocator, переносится при копирующем
+ * присваивании.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_TEST_SUPPORT_TRACKING_RESOURCE_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_TEST_SUPPORT_TRACKING_RESOURCE_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <set>
+#include <type_traits>
+
+namespace s21 {
+
+namespace test_support {
+
+/// Ресурс, который помнит свои блоки: освобождение чужого блока
+/// засчитывается в foreign.
+class TrackingResource : public std::pmr::memory_resource {
+ public:
+  std::set<void *> live;
+  int foreign = 0;
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override {
+    void *p = std::pmr::new_delete_resource()->allocate(bytes, align);
+    live.insert(p);
+    return p;
+  }
+  void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+    if (live.erase(p) == 0) ++foreign;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+/// Аллокатор поверх ресурса, который переносится при копирующем
+/// присваивании.
+template <typename T>
+struct CopyPropagatingAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+
+  explicit CopyPropagatingAllocator(std::pmr::memory_resource *r)
+      : resource(r) {}
+  template <typename U>
+  CopyPropagatingAllocator(const CopyPropagatingAllocator<U> &other)
+      : resource(other.resource) {}
+
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(resource->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *p, std::size_t n) {
+    resource->deallocate(p, n * sizeof(T), alignof(T));
+  }
+  bool operator==(const CopyPropagatingAllocator &other) const {
+    return resource == other.resource;
+  }
+  bool operator!=(const CopyPropagatingAllocator &other) const {
+    return resource != other.resource;
+  }
+
+  std::pmr::memory_resource *resource;
+};
+
+}  // namespace test_support
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_TEST_SUPPORT_TRACKING_RESOURCE_H_
@@ -13,9 +13,11 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_TREE_S21_REDBLACKTREE_H_
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_TREE_S21_REDBLACKTREE_H_
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace s21 {
 
@@ -365,36 +367,60 @@ class RedBlackTree {
    * булева значения, указывающего на успешность вставки.
    */
   std::pair<NodePtr, bool> insert(const Key& key) {
-    NodePtr y = nullptr;
-    NodePtr x = root_;
+    return insertFrom(root_, key);
+  }
 
-    // Ищем место и проверяем, существует ли ключ
-    while (x != nullptr) {
-      y = x;
-      if (comp_(key, x->key)) {
-        x = x->left;
-      } else if (comp_(x->key, key)) {
-        x = x->right;
+  /**
+   * @brief Статистика пакетной вставки insert_range().
+   */
+  struct InsertRangeStats {
+    std::size_t inserted = 0;  ///< Количество добавленных ключей.
+    std::size_t existing = 0;  ///< Количество ключей, которые уже были.
+  };
+
+  /**
+   * @brief Вставляет диапазон ключей за один проход слияния с деревом.
+   *
+   * Пакет копируется и, если он еще не отсортирован, устойчиво сортируется,
+   * поэтому при повторах в пакете побеждает первый ключ, как и при
+   * последовательных вызовах insert(). Каждый следующий ключ ищется не от
+   * корня, а от места предыдущей вставки: подъем идет только до предка, чье
+   * поддерево содержит новый ключ. Для плотных пакетов это заменяет полный
+   * спуск на несколько шагов.
+   *
+   * @param first Начало диапазона ключей.
+   * @param last Конец диапазона ключей.
+   * @return Количество вставленных и уже существовавших ключей.
+   */
+  template <typename InputIt>
+  InsertRangeStats insert_range(InputIt first, InputIt last) {
+    std::vector<Key> batch(first, last);
+    if (!std::is_sorted(batch.begin(), batch.end(), comp_)) {
+      std::stable_sort(batch.begin(), batch.end(), comp_);
+    }
+    InsertRangeStats stats;
+    NodePtr hint = nullptr;
+    // Максимум дерева: ключи больше него добавляются без подъема
+    NodePtr max = root_;
+    while (max && max->right) {
+      max = max->right;
+    }
+    for (const auto& key : batch) {
+      NodePtr start = (hint && hint == max && comp_(hint->key, key))
+                          ? hint
+                          : climbFrom(hint, key);
+      auto result = insertFrom(start, key);
+      hint = result.first;
+      if (!max || comp_(max->key, key)) {
+        max = hint;
+      }
+      if (result.second) {
+        ++stats.inserted;
       } else {
-        // Ключ уже существует; возвращаем указатель и false
-        return {x, false};
+        ++stats.existing;
       }
     }
-    // Вставляем новый узел
-    NodePtr newNode = std::make_shared<Node>(key, Color::RED);
-    newNode->parent = y;
-    if (y == nullptr) {
-      root_ = newNode;
-    } else if (comp_(key, y->key)) {
-      y->left = newNode;
-    } else {
-      y->right = newNode;
-    }
-    ++size_;
-    // Исправляем дерево
-    insertFixup(newNode);
-    // Возвращаем указатель и true
-    return {newNode, true};
+    return stats;
   }
 
   std::pair<NodePtr, bool> insert_mult(const Key& key) {
@@ -507,6 +533,99 @@ class RedBlackTree {
     return nullptr;  // Узел с заданным ключом не найден
   }
 
+  /**
+   * @brief Ищет узел с указанным ключом с программной предвыборкой потомков.
+   *
+   * Вариант find() для больших деревьев, не помещающихся в кэш. Пока
+   * сравнивается ключ текущего узла, для обоих его потомков выдается
+   * предвыборка, поэтому загрузка следующего уровня перекрывается со
+   * сравнением. Спуск идет по сырым указателям без копирования shared_ptr на
+   * каждом уровне.
+   *
+   * @param key Ключ, который нужно найти в дереве.
+   * @return Указатель на узел с данным ключом или `nullptr`, если такой узел не
+   * найден.
+   */
+  NodePtr find_prefetch(const Key& key) const {
+    const NodePtr* slot = &root_;
+    while (const Node* x = slot->get()) {
+      prefetchNode(x->left.get());
+      prefetchNode(x->right.get());
+      if (comp_(key, x->key)) {
+        slot = &x->left;
+      } else if (comp_(x->key, key)) {
+        slot = &x->right;
+      } else {
+        return *slot;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Ищет сразу несколько ключей, чередуя независимые спуски по дереву.
+   *
+   * Ключи обрабатываются группами по `group_size` штук. Внутри группы все
+   * спуски продвигаются на один уровень за проход, и для следующего узла
+   * каждого спуска выдается предвыборка. Пока один спуск ждет память, другие
+   * выполняют сравнения, так что промахи кэша перекрываются. При
+   * `group_size == 1` используется find_prefetch().
+   *
+   * @param keys Ключи для поиска.
+   * @param group_size Количество одновременных спусков (от 1 до
+   * kMaxFindGroup).
+   * @return Вектор того же размера, что и `keys`: узел с i-м ключом или
+   * `nullptr`, если ключ не найден.
+   */
+  std::vector<NodePtr> find_many(const std::vector<Key>& keys,
+                                 std::size_t group_size = 16) const {
+    std::vector<NodePtr> result(keys.size());
+    group_size = std::min(std::max<std::size_t>(group_size, 1), kMaxFindGroup);
+    if (group_size == 1) {
+      for (std::size_t i = 0; i < keys.size(); ++i) {
+        result[i] = find_prefetch(keys[i]);
+      }
+      return result;
+    }
+    const NodePtr* slots[kMaxFindGroup];
+    for (std::size_t base = 0; base < keys.size(); base += group_size) {
+      std::size_t count = std::min(group_size, keys.size() - base);
+      for (std::size_t i = 0; i < count; ++i) {
+        slots[i] = &root_;
+      }
+      prefetchNode(root_.get());
+      // Продвигаем каждый незавершенный спуск на один уровень за проход
+      std::size_t active = count;
+      while (active != 0) {
+        active = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+          if (slots[i] == nullptr) continue;
+          const Node* x = slots[i]->get();
+          const Key& key = keys[base + i];
+          if (x == nullptr) {
+            slots[i] = nullptr;  // Ключ не найден, result[i] уже nullptr
+            continue;
+          }
+          if (comp_(key, x->key)) {
+            slots[i] = &x->left;
+          } else if (comp_(x->key, key)) {
+            slots[i] = &x->right;
+          } else {
+            result[base + i] = *slots[i];
+            slots[i] = nullptr;
+            continue;
+          }
+          prefetchNode(slots[i]->get());
+          ++active;
+        }
+      }
+    }
+    return result;
+  }
+
+  /// Максимальное количество одновременных спусков в find_many().
+  static constexpr std::size_t kMaxFindGroup = 64;
+
   /**
    * @brief Выполняет левое вращение дерева вокруг узла x.
    *
@@ -738,6 +857,94 @@ class RedBlackTree {
       x->color = Color::BLACK;
     }
   }
+  /**
+   * @brief Вставляет ключ, начиная спуск с узла x вместо корня.
+   *
+   * Ключ обязан принадлежать диапазону поддерева x (см. climbFrom()).
+   *
+   * @param x Узел, с которого начинается спуск.
+   * @param key Ключ, который нужно вставить в дерево.
+   * @return Пара из указателя на узел (новый или существующий) и признака
+   * вставки.
+   */
+  std::pair<NodePtr, bool> insertFrom(NodePtr x, const Key& key) {
+    NodePtr y = nullptr;
+
+    // Ищем место и проверяем, существует ли ключ
+    while (x != nullptr) {
+      y = x;
+      if (comp_(key, x->key)) {
+        x = x->left;
+      } else if (comp_(x->key, key)) {
+        x = x->right;
+      } else {
+        // Ключ уже существует; возвращаем указатель и false
+        return {x, false};
+      }
+    }
+    // Вставляем новый узел
+    NodePtr newNode = std::make_shared<Node>(key, Color::RED);
+    newNode->parent = y;
+    if (y == nullptr) {
+      root_ = newNode;
+    } else if (comp_(key, y->key)) {
+      y->left = newNode;
+    } else {
+      y->right = newNode;
+    }
+    ++size_;
+    // Исправляем дерево
+    insertFixup(newNode);
+    // Возвращаем указатель и true
+    return {newNode, true};
+  }
+
+  /**
+   * @brief Находит узел, с которого нужно начать спуск для очередного ключа
+   * отсортированного пакета.
+   *
+   * Ключ не меньше ключа узла x, поэтому нижняя граница поддерева x уже
+   * выполнена. При подъеме по правой связи верхняя граница не меняется, и
+   * стартовым узлом остается самый глубокий подходящий. Подъем по левой связи
+   * к предку с большим ключом означает, что место найдено; иначе стартовым
+   * становится сам предок.
+   *
+   * @param x Узел предыдущей вставки или `nullptr`.
+   * @param key Вставляемый ключ.
+   * @return Корень поддерева, содержащего место для ключа.
+   */
+  NodePtr climbFrom(NodePtr x, const Key& key) const {
+    if (!x) return root_;
+    NodePtr start = x;
+    NodePtr parent = x->parent.lock();
+    while (parent) {
+      if (x == parent->left) {
+        if (comp_(key, parent->key)) {
+          return start;
+        }
+        start = parent;
+      }
+      x = parent;
+      parent = x->parent.lock();
+    }
+    return start;
+  }
+
+  /**
+   * @brief Выдает подсказку процессору загрузить узел в кэш.
+   *
+   * Предвыборка не изменяет состояние программы и безопасна для `nullptr`.
+   *
+   * @param node Указатель на узел, который скоро понадобится.
+   */
+  static void prefetchNode(const Node* node) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(node, 0, 1);
+#else
+    (void)node;
+#endif
+  }
+
   /**
    * @brief Рекурсивно копирует узлы дерева.
    *
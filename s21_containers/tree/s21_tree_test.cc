@@ -324,3 +324,69 @@ TEST(RedBlackTreeTest, EraseFixup_RightChildScenario4) {
   int blackCount = -1;
   ASSERT_TRUE(checkRedBlackProperties(tree.getRoot(), blackCount, 0));
 }
+
+TEST(RedBlackTreeTest, FindPrefetch) {
+  s21::RedBlackTree<int> tree;
+  ASSERT_EQ(tree.find_prefetch(1), nullptr);
+  for (int i = 0; i < 100; i += 2) {
+    tree.insert(i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(tree.find_prefetch(i), tree.find(i));
+  }
+}
+
+TEST(RedBlackTreeTest, FindManyMatchesFind) {
+  s21::RedBlackTree<int> tree;
+  std::vector<int> keys;
+  for (int i = 0; i < 200; ++i) {
+    if (i % 3 != 0) tree.insert(i * 7 % 200);
+    keys.push_back((i * 13) % 250);
+  }
+  // Размеры групп: одиночный спуск, неполная группа и больше максимума
+  for (std::size_t group : {1, 8, 32, 1000}) {
+    auto nodes = tree.find_many(keys, group);
+    ASSERT_EQ(nodes.size(), keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      ASSERT_EQ(nodes[i], tree.find(keys[i]));
+    }
+  }
+}
+
+TEST(RedBlackTreeTest, FindManyEmptyTree) {
+  s21::RedBlackTree<int> tree;
+  auto nodes = tree.find_many({1, 2, 3});
+  ASSERT_EQ(nodes.size(), 3U);
+  for (const auto& node : nodes) {
+    ASSERT_EQ(node, nullptr);
+  }
+  ASSERT_TRUE(tree.find_many({}).empty());
+}
+
+TEST(RedBlackTreeTest, InsertRangeSortedAndUnsorted) {
+  s21::RedBlackTree<int> tree;
+  std::vector<int> sorted;
+  for (int i = 0; i < 500; i += 2) sorted.push_back(i);
+  auto stats = tree.insert_range(sorted.begin(), sorted.end());
+  EXPECT_EQ(stats.inserted, sorted.size());
+  EXPECT_EQ(stats.existing, 0U);
+
+  // Несортированный пакет с повторами внутри себя и с деревом
+  std::vector<int> unsorted{7, 3, 1000, 3, 4, -5, 7, 999};
+  stats = tree.insert_range(unsorted.begin(), unsorted.end());
+  EXPECT_EQ(stats.inserted, 5U);
+  EXPECT_EQ(stats.existing, 3U);
+  EXPECT_EQ(tree.size(), sorted.size() + 5);
+
+  // Ключи пакета чередуются с ключами дерева
+  std::vector<int> odd;
+  for (int i = 1; i < 500; i += 2) odd.push_back(i);
+  stats = tree.insert_range(odd.begin(), odd.end());
+  EXPECT_EQ(stats.inserted + stats.existing, odd.size());
+
+  for (int key : sorted) ASSERT_NE(tree.find(key), nullptr);
+  for (int key : unsorted) ASSERT_NE(tree.find(key), nullptr);
+  for (int key : odd) ASSERT_NE(tree.find(key), nullptr);
+  int blackCount = -1;
+  ASSERT_TRUE(checkRedBlackProperties(tree.getRoot(), blackCount, 0));
+}
@@ -0,0 +1,29 @@
+/**
+ * @file s21_unordered_map.h
+ * @brief Неупорядоченный ассоциативный массив на основе хеш-таблицы.
+ *
+ * Класс unordered_map хранит пары "ключ-значение" в хеш-таблице с открытой
+ * адресацией (RobinHoodTable). В отличие от map, элементы не упорядочены, но
+ * поиск, вставка и удаление выполняются в среднем за O(1) и обращаются к
+ * одному непрерывному массиву вместо спуска по узлам дерева. Интерфейс
+ * повторяет s21::map и дополнен методами управления корзинами.
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_UNORDERED_MAP_S21_UNORDERED_MAP_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_UNORDERED_MAP_S21_UNORDERED_MAP_H_
+
+#include <functional>
+
+#include "../hashtable/hashmap.h"
+#include "../hashtable/robinhoodtable.h"
+
+namespace s21 {
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_map = HashMap<Key, Value, Hash, KeyEqual, RobinHoodTable>;
+
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_UNORDERED_MAP_S21_UNORDERED_MAP_H_
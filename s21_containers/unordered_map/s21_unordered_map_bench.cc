@@ -0,0 +1,78 @@
+// Бенчмарк точечных операций: s21::unordered_map против s21::map и
+// std::unordered_map. Замеряются вставка, успешный и неуспешный поиск.
+//
+// Запуск: ./bench.out [количество элементов]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../map/s21_map.h"
+#include "s21_unordered_map.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Seconds(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+template <typename Map>
+bool Contains(Map &map, long key) {
+  return map.find(key) != map.end();
+}
+
+// s21::map не имеет find(), ищем через contains()
+bool Contains(s21::map<long, long> &map, long key) { return map.contains(key); }
+
+template <typename Map>
+void Run(const char *name, const std::vector<long> &keys,
+         const std::vector<long> &missing) {
+  Map map;
+  auto start = Clock::now();
+  for (long key : keys) {
+    map.insert({key, key});
+  }
+  double insert = Seconds(start);
+
+  std::size_t found = 0;
+  start = Clock::now();
+  for (long key : keys) {
+    found += Contains(map, key);
+  }
+  double hit = Seconds(start);
+  start = Clock::now();
+  for (long key : missing) {
+    found += Contains(map, key);
+  }
+  double miss = Seconds(start);
+
+  double n = static_cast<double>(keys.size());
+  std::printf("  %-20s %10.2f %10.2f %10.2f   (found %zu)\n", name,
+              n / insert / 1e6, n / hit / 1e6, n / miss / 1e6, found);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 20;
+
+  std::mt19937_64 rng(42);
+  std::vector<long> keys(size), missing(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    keys[i] = static_cast<long>(rng() >> 1) | 1;  // нечетные присутствуют
+    missing[i] = static_cast<long>(rng() >> 1) & ~1L;  // четные отсутствуют
+  }
+
+  std::printf("%zu random long keys, million ops/s\n", size);
+  std::printf("  %-20s %10s %10s %10s\n", "container", "insert", "hit",
+              "miss");
+  Run<s21::map<long, long>>("s21::map", keys, missing);
+  Run<std::unordered_map<long, long>>("std::unordered_map", keys, missing);
+  Run<s21::unordered_map<long, long>>("s21::unordered_map", keys, missing);
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "../../s21_containers.h"
+
+TEST(UnorderedMapTest, InsertionAndAccess) {
+  s21::unordered_map<int, std::string> custom_map;
+  std::unordered_map<int, std::string> std_map;
+
+  EXPECT_TRUE(custom_map.insert({1, "one"}).second);
+  EXPECT_TRUE(custom_map.insert(2, "two").second);
+  EXPECT_FALSE(custom_map.insert(1, "uno").second);
+  std_map.insert({1, "one"});
+  std_map.insert({2, "two"});
+
+  EXPECT_EQ(custom_map.size(), std_map.size());
+  EXPECT_EQ(custom_map.at(1), std_map.at(1));
+  EXPECT_EQ(custom_map[2], std_map[2]);
+  EXPECT_THROW(custom_map.at(3), std::out_of_range);
+  custom_map[3] = "three";
+  EXPECT_EQ(custom_map.at(3), "three");
+  EXPECT_TRUE(custom_map.contains(3));
+  EXPECT_FALSE(custom_map.contains(4));
+}
+
+TEST(UnorderedMapTest, InsertOrAssign) {
+  s21::unordered_map<int, std::string> custom_map{{1, "one"}};
+
+  auto result = custom_map.insert_or_assign(1, "uno");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).second, "uno");
+  result = custom_map.insert_or_assign(2, "dos");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(custom_map.at(2), "dos");
+  EXPECT_EQ(custom_map.size(), 2U);
+}
+
+TEST(UnorderedMapTest, EraseAndIterate) {
+  s21::unordered_map<int, int> custom_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 100; ++i) {
+    custom_map.insert(i, i * i);
+    std_map.insert({i, i * i});
+  }
+  custom_map.erase(custom_map.find(10));
+  EXPECT_EQ(custom_map.erase(20), 1U);
+  EXPECT_EQ(custom_map.erase(20), 0U);
+  std_map.erase(10);
+  std_map.erase(20);
+
+  std::map<int, int> collected;
+  for (auto it = custom_map.begin(); it != custom_map.end(); ++it) {
+    collected.insert({it->first, it->second});
+  }
+  EXPECT_EQ(collected, std_map);
+}
+
+TEST(UnorderedMapTest, MergeSwapClear) {
+  s21::unordered_map<int, std::string> first{{1, "one"}, {2, "two"}};
+  s21::unordered_map<int, std::string> second{{2, "deux"}, {3, "trois"}};
+
+  first.merge(second);
+  EXPECT_EQ(first.size(), 3U);
+  EXPECT_EQ(first.at(2), "two");
+  EXPECT_TRUE(second.empty());
+
+  first.swap(second);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(second.size(), 3U);
+  second.clear();
+  EXPECT_TRUE(second.empty());
+  EXPECT_TRUE(second.begin() == second.end());
+}
+
+TEST(UnorderedMapTest, InsertMany) {
+  s21::unordered_map<int, std::string> custom_map{{1, "one"}};
+
+  auto results = custom_map.insert_many(std::make_pair(2, std::string("two")),
+                                        std::make_pair(1, std::string("x")),
+                                        std::make_pair(3, std::string("3")));
+
+  ASSERT_EQ(results.size(), 3U);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_TRUE(results[2].second);
+  EXPECT_EQ((*results[0].first).second, "two");
+  EXPECT_EQ((*results[1].first).second, "one");
+  EXPECT_EQ((*results[2].first).second, "3");
+}
+
+TEST(UnorderedMapTest, CustomHashAndLoadFactor) {
+  struct ModHash {
+    std::size_t operator()(int key) const { return key % 4; }
+  };
+  s21::unordered_map<int, int, ModHash> custom_map(16);
+  EXPECT_GE(custom_map.bucket_count(), 16U);
+  custom_map.max_load_factor(0.25f);
+  for (int i = 0; i < 64; ++i) custom_map[i] = i;
+  EXPECT_LE(custom_map.load_factor(), 0.25f);
+  for (int i = 0; i < 64; ++i) ASSERT_EQ(custom_map.at(i), i);
+
+  const auto copy = custom_map;
+  EXPECT_EQ(copy.at(5), 5);
+  EXPECT_TRUE(copy.find(100) == copy.cend());
+}
@@ -0,0 +1,29 @@
+/**
+ * @file s21_unordered_set.h
+ * @brief Неупорядоченное множество на основе хеш-таблицы.
+ *
+ * Контейнер unordered_set хранит уникальные ключи в хеш-таблице с открытой
+ * адресацией (RobinHoodTable). Интерфейс повторяет s21::set, но порядок
+ * обхода не определен, а поиск, вставка и удаление выполняются в среднем за
+ * O(1).
+ *
+ * @version 1.0
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_UNORDERED_SET_S21_UNORDERED_SET_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_UNORDERED_SET_S21_UNORDERED_SET_H_
+
+#include <functional>
+
+#include "../hashtable/hashset.h"
+#include "../hashtable/robinhoodtable.h"
+
+namespace s21 {
+
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using unordered_set = HashSet<Key, Hash, KeyEqual, RobinHoodTable>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_UNORDERED_SET_S21_UNORDERED_SET_H_
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "../../s21_containers.h"
+
+TEST(UnorderedSetTest, CompareWithStdSet) {
+  s21::unordered_set<int> my_set = {4, 2, 3, 1, 2};
+  std::set<int> std_set = {4, 2, 3, 1, 2};
+
+  EXPECT_EQ(my_set.size(), std_set.size());
+  std::set<int> collected(my_set.begin(), my_set.end());
+  EXPECT_EQ(collected, std_set);
+  EXPECT_TRUE(my_set.contains(3));
+  EXPECT_FALSE(my_set.contains(5));
+  EXPECT_EQ(*my_set.find(4), 4);
+  EXPECT_TRUE(my_set.find(7) == my_set.end());
+}
+
+TEST(UnorderedSetTest, InsertEraseMerge) {
+  s21::unordered_set<int> my_set;
+  EXPECT_TRUE(my_set.empty());
+  EXPECT_TRUE(my_set.insert(10).second);
+  EXPECT_FALSE(my_set.insert(10).second);
+  my_set.erase(my_set.find(10));
+  EXPECT_TRUE(my_set.empty());
+  EXPECT_EQ(my_set.erase(10), 0U);
+
+  s21::unordered_set<int> other = {1, 2, 3};
+  my_set.insert(3);
+  my_set.merge(other);
+  EXPECT_EQ(my_set.size(), 3U);
+  EXPECT_TRUE(other.empty());
+}
+
+TEST(UnorderedSetTest, InsertMany) {
+  s21::unordered_set<int> my_set = {1};
+
+  auto results = my_set.insert_many(1, 2, 3);
+
+  ASSERT_EQ(results.size(), 3U);
+  EXPECT_FALSE(results[0].second);
+  EXPECT_TRUE(results[1].second);
+  EXPECT_TRUE(results[2].second);
+  EXPECT_EQ(*results[1].first, 2);
+  EXPECT_EQ(my_set.size(), 3U);
+}
+
+TEST(UnorderedSetTest, CopyMoveSwap) {
+  s21::unordered_set<int> original = {1, 2, 3};
+  s21::unordered_set<int> copy(original);
+  s21::unordered_set<int> moved(std::move(original));
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_EQ(original.size(), 0U);
+
+  s21::unordered_set<int> other = {9};
+  other.swap(copy);
+  EXPECT_EQ(other.size(), 3U);
+  EXPECT_TRUE(copy.contains(9));
+}
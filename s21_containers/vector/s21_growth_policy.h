@@ -0,0 +1,63 @@
+/**
+ * @file s21_growth_policy.h
+ * @brief Стратегии роста буфера для s21::vector.
+ *
+ * Стратегия - это класс со статическим методом
+ * next_capacity(size, required, element_size), который возвращает новую
+ * емкость не меньше required, когда в буфере из size элементов не хватает
+ * места для required элементов.
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_GROWTH_POLICY_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_GROWTH_POLICY_H_
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+
+/**
+ * @brief Удвоение емкости, как у std::vector из libstdc++ (по умолчанию).
+ */
+struct doubling_growth {
+  static std::size_t next_capacity(std::size_t size, std::size_t required,
+                                   std::size_t /*element_size*/) {
+    return std::max(required, size * 2);
+  }
+};
+
+/**
+ * @brief Рост в 1.5 раза: меньше неиспользуемой памяти, и освобожденные
+ * ранее буферы со временем могут быть переиспользованы аллокатором.
+ */
+struct one_and_half_growth {
+  static std::size_t next_capacity(std::size_t size, std::size_t required,
+                                   std::size_t /*element_size*/) {
+    return std::max(required, size + size / 2);
+  }
+};
+
+/**
+ * @brief Удвоение с округлением размера буфера вверх до целого числа
+ * страниц.
+ *
+ * Большие буферы аллокатор все равно выделяет страницами, поэтому хвост
+ * последней страницы отдается вектору, а не теряется.
+ *
+ * @tparam PageSize Размер страницы в байтах.
+ */
+template <std::size_t PageSize = 4096>
+struct page_aligned_growth {
+  static std::size_t next_capacity(std::size_t size, std::size_t required,
+                                   std::size_t element_size) {
+    std::size_t capacity = doubling_growth::next_capacity(size, required, 0);
+    std::size_t bytes = capacity * element_size;
+    if (bytes < PageSize) return capacity;
+    bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+    return bytes / element_size;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_GROWTH_POLICY_H_
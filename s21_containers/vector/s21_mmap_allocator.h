@@ -0,0 +1,227 @@
+/**
+ * @file s21_mmap_allocator.h
+ * @brief Аллокатор для очень больших векторов: резервирует диапазон
+ * виртуальных адресов через mmap и подключает страницы по мере роста.
+ *
+ * allocate(n) резервирует не меньше reservation байт адресного
+ * пространства (PROT_NONE, физическая память не расходуется) и делает
+ * доступными только первые n элементов. Вектор обнаруживает у аллокатора
+ * методы try_expand и shrink: пока новая емкость помещается в резерв, буфер
+ * растет на месте через mprotect, и элементы никуда не переносятся.
+ * shrink_to_fit возвращает хвостовые страницы системе через
+ * madvise(MADV_DONTNEED). По запросу (huge_pages) данные выравниваются по
+ * 2 МиБ, диапазон помечается MADV_HUGEPAGE, и память подключается целыми
+ * большими страницами, чтобы ядро отображало ее прозрачными большими
+ * страницами и реже промахивалось в TLB.
+ *
+ * Резерв по умолчанию скромный (1 ГиБ): адресное пространство процесса
+ * ограничено (128 ТиБ при 47-битных адресах), а каждый живой буфер держит
+ * свой резерв целиком. Векторам, которые должны расти дальше без переноса,
+ * резерв задается явно.
+ *
+ * Размер резерва и подключенной части хранится в служебной странице перед
+ * данными, поэтому освободить буфер может любой экземпляр аллокатора.
+ *
+ * Только для POSIX-систем; MADV_HUGEPAGE есть только в Linux.
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_MMAP_ALLOCATOR_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_MMAP_ALLOCATOR_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+/**
+ * @brief Аллокатор с резервированием адресного пространства через mmap.
+ *
+ * @tparam T Тип элементов.
+ */
+template <typename T>
+class mmap_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using is_always_equal = std::true_type;
+
+  /// Резерв адресного пространства по умолчанию - 1 ГиБ.
+  static constexpr size_type kDefaultReservation = size_type{1} << 30;
+  /// Размер прозрачной большой страницы: выравнивание данных и шаг
+  /// подключения памяти при huge_pages.
+  static constexpr size_type kHugePageSize = size_type{2} << 20;
+
+  /**
+   * @param reservation Сколько байт адресного пространства резервировать под
+   * один буфер; до этого размера вектор растет без переноса.
+   * @param huge_pages Запрашивать ли прозрачные большие страницы.
+   */
+  explicit mmap_allocator(size_type reservation = kDefaultReservation,
+                          bool huge_pages = false) noexcept
+      : reservation_(reservation), huge_pages_(huge_pages) {}
+
+  template <typename U>
+  mmap_allocator(const mmap_allocator<U> &other) noexcept
+      : reservation_(other.reservation()), huge_pages_(other.huge_pages()) {}
+
+  size_type reservation() const { return reservation_; }
+  bool huge_pages() const { return huge_pages_; }
+
+  T *allocate(size_type n) {
+    static_assert(alignof(T) <= 4096, "page alignment is not enough for T");
+    if (n > maxElements()) throw std::bad_array_new_length();
+    size_type page = pageSize();
+    size_type reserved = page + std::max(roundUp(reservation_, chunk()),
+                                         roundUp(n * sizeof(T), chunk()));
+    char *base = reserve(reserved);
+    if (base == nullptr) throw std::bad_alloc();
+    if (mprotect(base, page, PROT_READ | PROT_WRITE) != 0) {
+      munmap(base, reserved);
+      throw std::bad_alloc();
+    }
+    Header *header = reinterpret_cast<Header *>(base);
+    header->reserved = reserved;
+    header->committed = page;
+#ifdef MADV_HUGEPAGE
+    if (huge_pages_) madvise(base + page, reserved - page, MADV_HUGEPAGE);
+#endif
+    if (!commit(header, page + n * sizeof(T))) {
+      munmap(base, reserved);
+      throw std::bad_alloc();
+    }
+    return reinterpret_cast<T *>(base + page);
+  }
+
+  void deallocate(T *p, size_type /*n*/) noexcept {
+    Header *header = headerOf(p);
+    munmap(header, header->reserved);
+  }
+
+  /**
+   * @brief Расширяет буфер p до new_n элементов на месте.
+   *
+   * @return false, если new_n не помещается в резерв или система отказала;
+   * тогда буфер не меняется.
+   */
+  bool try_expand(T *p, size_type /*old_n*/, size_type new_n) noexcept {
+    if (new_n > maxElements()) return false;
+    return commit(headerOf(p), pageSize() + new_n * sizeof(T));
+  }
+
+  /**
+   * @brief Возвращает системе страницы буфера p за пределами new_n
+   * элементов. Резерв адресов сохраняется для последующего роста.
+   */
+  void shrink(T *p, size_type /*old_n*/, size_type new_n) noexcept {
+    Header *header = headerOf(p);
+    size_type keep =
+        std::min(pageSize() + roundUp(new_n * sizeof(T), chunk()),
+                 header->committed);
+    if (keep == header->committed) return;
+    char *tail = reinterpret_cast<char *>(header) + keep;
+    size_type length = header->committed - keep;
+    madvise(tail, length, MADV_DONTNEED);
+    mprotect(tail, length, PROT_NONE);
+    header->committed = keep;
+  }
+
+  /// Сколько байт буфера p сейчас доступно, включая служебную страницу.
+  static size_type committed_bytes(const T *p) noexcept {
+    return headerOf(p)->committed;
+  }
+
+  friend bool operator==(const mmap_allocator &, const mmap_allocator &) {
+    return true;
+  }
+  friend bool operator!=(const mmap_allocator &, const mmap_allocator &) {
+    return false;
+  }
+
+ private:
+#ifdef MAP_NORESERVE
+  static constexpr int kMapFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#else
+  static constexpr int kMapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif
+
+  // Служебная страница перед данными; смещения считаются от ее начала
+  struct Header {
+    size_type reserved;
+    size_type committed;
+  };
+
+  size_type reservation_;
+  bool huge_pages_;
+
+  static size_type pageSize() {
+    static const size_type page = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+    return page;
+  }
+
+  static size_type roundUp(size_type bytes, size_type step) {
+    return (bytes + step - 1) / step * step;
+  }
+
+  static size_type maxElements() {
+    return (std::numeric_limits<size_type>::max() / 2) / sizeof(T);
+  }
+
+  static Header *headerOf(const T *p) {
+    return reinterpret_cast<Header *>(
+        const_cast<char *>(reinterpret_cast<const char *>(p)) - pageSize());
+  }
+
+  size_type chunk() const { return huge_pages_ ? kHugePageSize : pageSize(); }
+
+  /**
+   * @brief Резервирует length байт так, чтобы данные за служебной страницей
+   * начинались на границе chunk. Возвращает начало служебной страницы или
+   * nullptr.
+   */
+  char *reserve(size_type length) const {
+    size_type page = pageSize();
+    // Запас на выравнивание; лишнее по краям сразу возвращается системе
+    size_type slack = chunk() - page;
+    void *mapping = mmap(nullptr, length + slack, PROT_NONE, kMapFlags, -1, 0);
+    if (mapping == MAP_FAILED) return nullptr;
+    char *first = static_cast<char *>(mapping);
+    size_type address =
+        static_cast<size_type>(reinterpret_cast<std::uintptr_t>(first)) + page;
+    char *data = first + page + (roundUp(address, chunk()) - address);
+    char *base = data - page;
+    if (base != first) munmap(first, static_cast<size_type>(base - first));
+    char *end = first + length + slack;
+    if (base + length != end) {
+      munmap(base + length, static_cast<size_type>(end - (base + length)));
+    }
+    return base;
+  }
+
+  /// Делает доступными первые bytes байт резерва; данные подключаются
+  /// целыми chunk от их начала.
+  bool commit(Header *header, size_type bytes) const {
+    if (bytes <= header->committed) return true;
+    if (bytes > header->reserved) return false;
+    size_type page = pageSize();
+    size_type target =
+        std::min(page + roundUp(bytes - page, chunk()), header->reserved);
+    char *base = reinterpret_cast<char *>(header);
+    if (mprotect(base + header->committed, target - header->committed,
+                 PROT_READ | PROT_WRITE) != 0) {
+      return false;
+    }
+    header->committed = target;
+    return true;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_MMAP_ALLOCATOR_H_
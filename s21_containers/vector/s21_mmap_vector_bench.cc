@@ -0,0 +1,133 @@
+// Бенчмарк большого s21::vector<uint64_t>: std::allocator против
+// s21::mmap_allocator без больших страниц и с MADV_HUGEPAGE.
+//
+// Первый замер - заполнение push_back без reserve: с std::allocator каждое
+// удвоение копирует весь буфер, с mmap_allocator буфер растет на месте.
+// Второй - случайные чтения по всему буферу, где основную цену составляют
+// промахи TLB. Промахи dTLB считаются через perf_event_open, если ядро
+// разрешает (иначе печатается "n/a").
+//
+// Запуск: ./bench.out [количество элементов]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "s21_mmap_allocator.h"
+#include "s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Счетчик промахов dTLB при чтении; -1, если недоступен
+class TlbMissCounter {
+ public:
+  TlbMissCounter() {
+#ifdef __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+
+  ~TlbMissCounter() {
+#ifdef __linux__
+    if (fd_ >= 0) close(fd_);
+#endif
+  }
+
+  void Start() {
+#ifdef __linux__
+    if (fd_ < 0) return;
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+  }
+
+  long long Stop() {
+    long long count = -1;
+#ifdef __linux__
+    if (fd_ < 0) return -1;
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd_, &count, sizeof(count)) != sizeof(count)) count = -1;
+#endif
+    return count;
+  }
+
+ private:
+  int fd_ = -1;
+};
+
+template <typename Vector>
+void Run(const char *name, std::size_t size, Vector vector) {
+  auto start = Clock::now();
+  for (std::size_t i = 0; i < size; ++i) {
+    vector.push_back(i);
+  }
+  double fill_ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+  const std::size_t kReads = 1 << 24;
+  TlbMissCounter counter;
+  std::uint64_t state = 88172645463325252ULL;
+  std::uint64_t sum = 0;
+  start = Clock::now();
+  counter.Start();
+  for (std::size_t i = 0; i < kReads; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    sum += vector[state % size];
+  }
+  long long misses = counter.Stop();
+  double read_ns =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count() /
+      static_cast<double>(kReads);
+
+  char misses_text[32] = "n/a";
+  if (misses >= 0) {
+    std::snprintf(misses_text, sizeof(misses_text), "%.3f",
+                  static_cast<double>(misses) / static_cast<double>(kReads));
+  }
+  std::printf("  %-26s %10.1f %12.2f %14s\n", name, fill_ms, read_ns,
+              misses_text);
+  if (sum == 42) std::printf("\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 27;
+
+  using MmapAlloc = s21::mmap_allocator<std::uint64_t>;
+  std::printf("%zu uint64_t elements (%zu MiB)\n", size,
+              size * sizeof(std::uint64_t) >> 20);
+  std::printf("  %-26s %10s %12s %14s\n", "allocator", "fill, ms",
+              "read, ns", "dTLB miss/read");
+  Run("std::allocator", size, s21::vector<std::uint64_t>());
+  // Резерв с запасом на удвоение: весь рост до size элементов без переноса
+  std::size_t reservation = 2 * size * sizeof(std::uint64_t);
+  Run("mmap_allocator", size,
+      s21::vector<std::uint64_t, MmapAlloc>(MmapAlloc(reservation, false)));
+  Run("mmap_allocator hugepages", size,
+      s21::vector<std::uint64_t, MmapAlloc>(MmapAlloc(reservation, true)));
+  return 0;
+}
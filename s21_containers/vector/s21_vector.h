@@ -17,7 +17,16 @@
  * - Размер хранимого массива (метод size()).
  * - Размер буфера (метод capacity()).
  *
+ * Память выделяется, а элементы создаются и уничтожаются через аллокатор
+ * (std::allocator_traits), поэтому подходят std::pmr::polymorphic_allocator,
+ * аренные и NUMA-аллокаторы, а выравнивание типов с повышенным alignof
+ * соблюдается. Если у аллокатора есть методы try_expand и shrink (как у
+ * s21::mmap_allocator), буфер растет и уменьшается на месте, без переноса
+ * элементов.
+ *
  * @tparam T Тип элементов, которые хранит вектор.
+ * @tparam Allocator Аллокатор, совместимый с std::allocator_traits.
+ * @tparam GrowthPolicy Стратегия роста буфера (s21_growth_policy.h).
  */
 
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_VECTOR_H_
@@ -25,17 +34,33 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+#include "s21_vector_detail.h"
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = doubling_growth>
 class vector {
+  using AllocTraits = std::allocator_traits<Allocator>;
+
  public:
   /*внутриклассовые переопределения типов*/
 
   using value_type = T;
+  using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
@@ -53,6 +78,12 @@ class vector {
    */
   vector() : size_(0), capacity_(0), data_(nullptr) {}
 
+  /**
+   * @brief Создает пустой вектор, использующий аллокатор alloc.
+   */
+  explicit vector(const allocator_type &alloc)
+      : size_(0), capacity_(0), data_(nullptr), alloc_(alloc) {}
+
   /**
    * @brief Конструктор класса vector с заданным размером.
    *
@@ -60,9 +91,20 @@ class vector {
    * инициализируется значением по умолчанию.
    *
    * @param n Размер вектора, который нужно создать.
+   * @param alloc Аллокатор вектора.
    */
-  explicit vector(size_type n)
-      : size_(n), capacity_(n), data_(new value_type[n]{}) {}
+  explicit vector(size_type n, const allocator_type &alloc = allocator_type())
+      : size_(0), capacity_(n), alloc_(alloc) {
+    data_ = allocate(n);
+    try {
+      for (; size_ < n; ++size_) {
+        AllocTraits::construct(alloc_, data_ + size_);
+      }
+    } catch (...) {
+      abandon();
+      throw;
+    }
+  }
 
   /**
    * @brief Конструктор класса vector с использованием списка инициализации.
@@ -72,14 +114,20 @@ class vector {
    *
    * @param items Список инициализации, содержащий элементы для инициализации
    * вектора.
+   * @param alloc Аллокатор вектора.
    */
-  explicit vector(std::initializer_list<value_type> const &items)
-      : size_(items.size()),
-        capacity_(items.size()),
-        data_(new value_type[items.size()]) {
-    size_type i = 0;
-    for (const_reference item : items) {
-      data_[i++] = item;
+  explicit vector(std::initializer_list<value_type> const &items,
+                  const allocator_type &alloc = allocator_type())
+      : size_(0), capacity_(items.size()), alloc_(alloc) {
+    data_ = allocate(items.size());
+    try {
+      for (const_reference item : items) {
+        AllocTraits::construct(alloc_, data_ + size_, item);
+        ++size_;
+      }
+    } catch (...) {
+      abandon();
+      throw;
     }
   }
 
@@ -91,11 +139,17 @@ class vector {
    * @param v Вектор, который нужно скопировать.
    */
   vector(const vector &v)
-      : size_(v.size_),
+      : size_(0),
         capacity_(v.capacity_),
-        data_(new value_type[v.capacity_]) {
-    for (size_type i = 0; i < size_; ++i) {
-      data_[i] = v[i];
+        alloc_(AllocTraits::select_on_container_copy_construction(v.alloc_)) {
+    data_ = allocate(v.capacity_);
+    try {
+      for (; size_ < v.size_; ++size_) {
+        AllocTraits::construct(alloc_, data_ + size_, v.data_[size_]);
+      }
+    } catch (...) {
+      abandon();
+      throw;
     }
   }
 
@@ -107,7 +161,11 @@ class vector {
    *
    * @param v Вектор, из которого ресурсы будут перемещены.
    */
-  vector(vector &&v) : size_(v.size_), capacity_(v.capacity_), data_(v.data_) {
+  vector(vector &&v)
+      : size_(v.size_),
+        capacity_(v.capacity_),
+        data_(v.data_),
+        alloc_(std::move(v.alloc_)) {
     v.data_ = nullptr;
     v.size_ = 0;
     v.capacity_ = 0;
@@ -120,12 +178,8 @@ class vector {
    * устанавливает указатели и размеры вектора в нулевые значения.
    */
   ~vector() {
-    if (data_ != nullptr) {
-      for (size_type i = 0; i < size_; ++i) {
-        data_[i].~value_type();  // Вызываем деструкторы для элементов.
-      }
-      delete[] data_;  // Освобождаем выделенную память.
-    }
+    clear();            // Вызываем деструкторы для элементов.
+    deallocate(data_);  // Освобождаем выделенную память.
     data_ = nullptr;
     size_ = 0;
     capacity_ = 0;
@@ -135,7 +189,9 @@ class vector {
    * @brief Оператор перемещения для класса vector.
    *
    * Этот оператор перемещает данные из вектора `v` в текущий вектор и
-   * освобождает ресурсы, занимаемые данными текущего вектора.
+   * освобождает ресурсы, занимаемые данными текущего вектора. Если аллокатор
+   * не переносится при перемещении и аллокаторы не равны, буфер `v` нельзя
+   * забрать: элементы перемещаются по одному в память своего аллокатора.
    *
    * @param v Вектор, из которого будут перемещены данные.
    * @return Ссылка на текущий вектор после перемещения.
@@ -145,7 +201,22 @@ class vector {
       return *this;
     }
     // Очищаем текущий массив
-    delete[] data_;
+    clear();
+    if constexpr (!AllocTraits::propagate_on_container_move_assignment::value) {
+      if (alloc_ != v.alloc_) {
+        reserve(v.size_);
+        for (; size_ < v.size_; ++size_) {
+          AllocTraits::construct(alloc_, data_ + size_,
+                                 std::move(v.data_[size_]));
+        }
+        v.clear();
+        return *this;
+      }
+    }
+    deallocate(data_);
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      alloc_ = std::move(v.alloc_);
+    }
 
     // Копируем данные из донора
     data_ = v.data_;
@@ -216,6 +287,12 @@ class vector {
    * @return Указатель на внутренний массив данных вектора.
    */
   value_type *data() { return data_; }
+  const value_type *data() const { return data_; }
+
+  /**
+   * @brief Возвращает копию аллокатора вектора.
+   */
+  allocator_type get_allocator() const { return alloc_; }
 
   /*публичные методы для итерирования*/
 
@@ -267,7 +344,7 @@ class vector {
    * @return Константный итератор на конец вектора.
    */
   const_iterator cend() {
-    return data_;  // Где data_ - указатель на первый элемент вектора
+    return data_ + size_;  // Где size_ - текущий размер вектора
   }
 
   /**
@@ -278,7 +355,7 @@ class vector {
    *
    * @return `true`, если контейнер пуст; `false`, если он содержит элементы.
    */
-  bool empty() {
+  bool empty() const {
     bool result = true;
     if (size_) {
       result = false;
@@ -294,7 +371,7 @@ class vector {
    *
    * @return Количество элементов в контейнере.
    */
-  size_type size() { return size_; }
+  size_type size() const { return size_; }
 
   /**
    * @brief Метод для получения максимально возможного количества элементов в
@@ -332,40 +409,7 @@ class vector {
    */
   void reserve(size_type new_size) {
     if (new_size < capacity_) return;
-
-    // Необычный способ выделения памяти позволяет избежать вызова деструктора
-    // при уничтожении временного массива.
-    value_type *tmp =
-        reinterpret_cast<T *>(new int8_t[new_size * sizeof(value_type)]);
-
-    // Правильный способ: скопировать с вызовом конструктора, затем, в случае
-    // исключения, вызвать деструкторы и освободить память.
-    // try {
-    //     std::uninitialized_copy(data_, data_ + size_, tmp);
-    // } catch (...) {
-    //     // Вызов деструкторов только у скопированных элементов
-    //     for (size_type i = 0; i < size_; ++i) {
-    //         (tmp + i)->~value_type();
-    //     }
-    //     delete[] reinterpret_cast<int8_t*>(tmp);
-    //     throw;
-    // }
-
-    // Копируем массив без вызова конструктора, чтобы избежать вызова
-    // конструктора по умолчанию, так как не все типы имеют конструктор по
-    // умолчанию.
-    std::uninitialized_copy(data_, data_ + size_, tmp);
-
-    // Вызываем деструкторы только у старых элементов массива.
-    for (size_type i = 0; i < size_; ++i) {
-      (data_ + i)->~value_type();
-    }
-
-    // Удаляем старый массив, используя интерпретацию к типу int8_t, чтобы
-    // избежать вызова деструктора.
-    delete[] reinterpret_cast<int8_t *>(data_);
-    data_ = tmp;
-    capacity_ = new_size;
+    relocate(new_size);
   }
 
   /**
@@ -376,7 +420,7 @@ class vector {
    *
    * @return Текущая емкость контейнера.
    */
-  size_type capacity() { return capacity_; }
+  size_type capacity() const { return capacity_; }
 
   /**
    * @brief Метод для уменьшения использования памяти путем освобождения
@@ -389,35 +433,7 @@ class vector {
    */
   void shrink_to_fit() {
     if (size_ < capacity_) {
-      // Необычный способ выделения памяти позволяет избежать вызова деструктора
-      // при уничтожении временного массива.
-      value_type *tmp =
-          reinterpret_cast<T *>(new int8_t[size_ * sizeof(value_type)]);
-
-      // Правильный способ: скопировать с вызовом конструктора, затем, в случае
-      // исключения, вызвать деструкторы и освободить память.
-      // try {
-      //     std::uninitialized_copy(data_, data_ + size_, tmp);
-      // } catch (...) {
-      //     // Вызов деструкторов только у скопированных элементов
-      //     for (size_type i = 0; i < size_; ++i) {
-      //         (tmp + i)->~value_type();
-      //     }
-      //     delete[] reinterpret_cast<int8_t*>(tmp);
-      //     throw;
-      // }
-
-      // Копируем массив без вызова конструктора, чтобы избежать вызова
-      // конструктора по умолчанию, так как не все типы имеют конструктор по
-      // умолчанию.
-      std::uninitialized_copy(data_, data_ + size_, tmp);
-      for (size_type i = 0; i < size_; ++i) {
-        (data_ + i)->~value_type();
-      }
-      delete[] reinterpret_cast<int8_t *>(data_);
-      data_ = tmp;
-      tmp = nullptr;
-      capacity_ = size_;
+      relocate(size_);
     }
   }
 
@@ -433,11 +449,45 @@ class vector {
   void clear() {
     // Вызываем деструкторы только у существующих элементов массива.
     for (size_type i = 0; i < size_; ++i) {
-      (data_ + i)->~value_type();
+      AllocTraits::destroy(alloc_, data_ + i);
     }
     size_ = 0;
   }
 
+  /**
+   * @brief Изменяет размер вектора на n элементов.
+   *
+   * Лишние элементы уничтожаются, новые создаются инициализацией значением
+   * (нули для арифметических типов). Буфер растет по стратегии роста.
+   */
+  void resize(size_type n) {
+    growTo(n, [this](value_type *p) { AllocTraits::construct(alloc_, p); });
+  }
+
+  /**
+   * @brief Изменяет размер вектора на n элементов, новые элементы копируются
+   * из value.
+   */
+  void resize(size_type n, const_reference value) {
+    value_type copy(value);  // value может быть элементом, который перенесем
+    growTo(n, [this, &copy](value_type *p) {
+      AllocTraits::construct(alloc_, p, copy);
+    });
+  }
+
+  /**
+   * @brief Изменяет размер вектора на n элементов, новые элементы
+   * инициализируются по умолчанию.
+   *
+   * Для тривиальных типов (int, POD-структуры) память новых элементов не
+   * заполняется, поэтому буфер можно сразу заполнить через data(), например
+   * чтением из файла, без лишнего обнуления. Значения таких элементов до
+   * записи не определены.
+   */
+  void resize_uninitialized(size_type n) {
+    growTo(n, [](value_type *p) { ::new (static_cast<void *>(p)) value_type; });
+  }
+
   /**
    * @brief Метод для вставки элементов в указанную позицию и возврата итератора
    * на новый элемент.
@@ -452,24 +502,113 @@ class vector {
    * @param value Значение элемента для вставки.
    * @return Итератор, указывающий на новый элемент.
    */
-  iterator insert(iterator pos, const_reference value) {
-    if (size_ == capacity_) {
-      // Так как при вызове функции reserve происходит изменение адресов
-      // элементов массива, нужно запомнить расстояние от начала массива до
-      // нужной позиции.
-      std::ptrdiff_t diff = pos - begin();
-      reserve(size_ == 0 ? 1 : size_ * 2);
-      pos = begin() + diff;
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  /**
+   * @brief Вставляет элемент в указанную позицию, перемещая значение.
+   */
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  /**
+   * @brief Создает элемент из аргументов args перед позицией pos.
+   *
+   * При вставке в конец и при переполнении буфера элемент создается сразу на
+   * своем месте. При вставке в середину он создается до сдвига хвоста, так
+   * как аргументы могут ссылаться на элементы самого вектора, и затем
+   * перемещается на освободившееся место.
+   *
+   * @param pos Позиция, перед которой вставляется элемент.
+   * @param args Аргументы конструктора элемента.
+   * @return Итератор, указывающий на новый элемент.
+   */
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = static_cast<size_type>(pos - data_);
+    if (size_ == capacity_ && !tryExpand(growCapacity(size_ + 1))) {
+      reallocInsert(index, std::forward<Args>(args)...);
+    } else if (index == size_) {
+      AllocTraits::construct(alloc_, data_ + size_,
+                             std::forward<Args>(args)...);
+      ++size_;
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      AllocTraits::construct(alloc_, data_ + size_,
+                             std::move(data_[size_ - 1]));
+      ++size_;
+      // Смещаем все позиции после нужного элемента вправо.
+      std::move_backward(data_ + index, data_ + size_ - 2,
+                         data_ + size_ - 1);
+      data_[index] = std::move(value);
     }
-    pos->~value_type();
-    // Смещаем все позиции после нужного элемента вправо.
-    for (iterator it = end(); it > pos; --it) {
-      *it = *(it - 1);
+    return data_ + index;
+  }
+
+  /**
+   * @brief Вставляет count копий value перед позицией pos.
+   *
+   * Память перераспределяется не более одного раза, хвост сдвигается один
+   * раз. value может ссылаться на элемент самого вектора.
+   *
+   * @return Итератор на первый вставленный элемент.
+   */
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    size_type index = static_cast<size_type>(pos - data_);
+    if (count == 0) return data_ + index;
+    value_type copy(value);
+    return insertGap(index, count, [this, count, &copy](value_type *dst) {
+      size_type built = 0;
+      try {
+        for (; built < count; ++built) {
+          AllocTraits::construct(alloc_, dst + built, copy);
+        }
+      } catch (...) {
+        destroyRange(dst, dst + built);
+        throw;
+      }
+    });
+  }
+
+  /**
+   * @brief Вставляет элементы диапазона [first, last) перед позицией pos.
+   *
+   * Для прямых итераторов итоговый размер известен заранее: память
+   * перераспределяется не более одного раза, хвост сдвигается один раз, а
+   * элементы создаются сразу на своих местах. Однопроходные итераторы
+   * дописываются в конец и затем переставляются одним поворотом. Диапазон не
+   * должен указывать на элементы самого вектора.
+   *
+   * @return Итератор на первый вставленный элемент.
+   */
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = static_cast<size_type>(pos - data_);
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      size_type count = static_cast<size_type>(std::distance(first, last));
+      return insertGap(index, count, [this, first, last](value_type *dst) {
+        value_type *out = dst;
+        try {
+          for (InputIt it = first; it != last; ++it, ++out) {
+            AllocTraits::construct(alloc_, out, *it);
+          }
+        } catch (...) {
+          destroyRange(dst, out);
+          throw;
+        }
+      });
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) {
+        emplace_back(*first);
+      }
+      std::rotate(data_ + index, data_ + old_size, data_ + size_);
+      return data_ + index;
     }
-    // Стираем данные из текущей позиции.
-    new (pos) value_type(value);  // Вставляем данные в нужную позицию.
-    ++size_;
-    return pos;
   }
 
   /**
@@ -482,12 +621,10 @@ class vector {
    * @param pos Итератор, указывающий на позицию элемента для удаления.
    */
   void erase(iterator pos) {
-    pos->~value_type();
-    while (pos != end()) {
-      *pos = *(pos + 1);  // Смещаем все элементы правее удаляемого влево.
-      pos++;
-    }
+    // Смещаем все элементы правее удаляемого влево.
+    std::move(pos + 1, end(), pos);
     --size_;
+    AllocTraits::destroy(alloc_, data_ + size_);
   }
 
   /**
@@ -499,12 +636,32 @@ class vector {
    *
    * @param value Значение элемента для добавления в конец контейнера.
    */
-  void push_back(const_reference value) {
-    if (size_ == capacity_) {
-      reserve(size_ == 0 ? 1 : size_ * 2);
+  void push_back(const_reference value) { emplace_back(value); }
+
+  /**
+   * @brief Добавляет элемент в конец контейнера, перемещая значение.
+   */
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  /**
+   * @brief Создает элемент из аргументов args прямо в конце буфера.
+   *
+   * Если буфер заполнен, элемент создается в новом буфере до переноса
+   * старых элементов, поэтому аргументы могут ссылаться на элементы самого
+   * вектора.
+   *
+   * @return Ссылка на созданный элемент.
+   */
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_ && !tryExpand(growCapacity(size_ + 1))) {
+      reallocInsert(size_, std::forward<Args>(args)...);
+    } else {
+      AllocTraits::construct(alloc_, data_ + size_,
+                             std::forward<Args>(args)...);
+      ++size_;
     }
-    new (data_ + size_) value_type(value);
-    ++size_;
+    return data_[size_ - 1];
   }
 
   /**
@@ -515,7 +672,8 @@ class vector {
    */
   void pop_back() {
     --size_;
-    data_[size_].~value_type();  // Вызываем деструктор последнего элемента.
+    // Вызываем деструктор последнего элемента.
+    AllocTraits::destroy(alloc_, data_ + size_);
   }
 
   /**
@@ -525,10 +683,15 @@ class vector {
    * контейнера `other`. После обмена, текущий контейнер будет содержать
    * элементы из `other`, а `other` будет содержать элементы из текущего
    * контейнера. Емкость и размер обоих контейнеров также могут измениться.
+   * Как и у std::vector, аллокаторы без propagate_on_container_swap должны
+   * быть равны.
    *
    * @param other Другой контейнер для обмена содержимым.
    */
   void swap(vector &other) {
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
     std::swap(data_, other.data_);
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
@@ -546,8 +709,13 @@ class vector {
    *            которой будут вставлены элементы.
    * @param args Аргументы, представляющие элементы, которые будут вставлены в
    *             вектор.
-   * @return Итератор, указывающий на последний вставленный элемент. Это может
-   *         быть полезно, если вам нужно знать, где закончилась вставка.
+   * @return Итератор, указывающий на позицию за последним вставленным
+   *         элементом. Это может быть полезно, если вам нужно знать, где
+   *         закончилась вставка.
+   *
+   * Итоговый размер известен заранее, поэтому память перераспределяется не
+   * более одного раза, хвост сдвигается один раз, а каждый элемент создается
+   * из своего аргумента сразу на своем месте.
    *
    * Пример использования:
    * \code{.cpp}
@@ -559,14 +727,15 @@ class vector {
    */
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    vector<value_type> tmp{args...};
-    iterator cur_pos = begin() + (pos - cbegin());
-    for (size_t i = 0; i < tmp.size(); ++i) {
-      cur_pos =
-          insert(cur_pos, tmp[i]) + 1;  //двигаем итератор на след. позицию
+    if ((vector_detail::isElement(args, data_, data_ + size_) || ...)) {
+      return insert_many(pos, value_type(std::forward<Args>(args))...);
     }
-
-    return cur_pos;
+    size_type index = static_cast<size_type>(pos - data_);
+    constexpr size_type count = sizeof...(Args);
+    insertGap(index, count, [&](value_type *dst) {
+      vector_detail::constructEach(alloc_, dst, std::forward<Args>(args)...);
+    });
+    return data_ + index + count;
   }
 
   /**
@@ -581,16 +750,203 @@ class vector {
    */
   template <typename... Args>
   void insert_many_back(Args &&...args) {
-    vector<value_type> tmp{args...};
-    for (size_t i = 0; i < tmp.size(); ++i) {
-      insert(end(), tmp[i]);
-    }
+    (emplace_back(std::forward<Args>(args)), ...);
   }
 
  private:
   size_type size_;
   size_type capacity_;
   value_type *data_ = nullptr;
+
+  allocator_type alloc_;
+
+  /**
+   * @brief Выделяет через аллокатор неинициализированную память под n
+   * элементов.
+   *
+   * Элементы создаются в ней через AllocTraits::construct, поэтому тип не
+   * обязан иметь конструктор по умолчанию.
+   */
+  value_type *allocate(size_type n) {
+    return n == 0 ? nullptr : AllocTraits::allocate(alloc_, n);
+  }
+
+  void deallocate(value_type *ptr) {
+    if (ptr != nullptr) {
+      AllocTraits::deallocate(alloc_, ptr, capacity_);
+    }
+  }
+
+  // Освобождает недостроенный вектор, если конструктор элемента бросил
+  // исключение: деструктор для такого объекта не вызывается
+  void abandon() {
+    clear();
+    deallocate(data_);
+  }
+
+  // Аллокатор с методами try_expand(p, old_n, new_n) и shrink(p, old_n,
+  // new_n) меняет размер буфера на месте (s21_mmap_allocator.h)
+  template <typename A>
+  using TryExpandCall = decltype(std::declval<A &>().try_expand(
+      std::declval<value_type *>(), size_type{}, size_type{}));
+  template <typename A>
+  using ShrinkCall = decltype(std::declval<A &>().shrink(
+      std::declval<value_type *>(), size_type{}, size_type{}));
+  template <typename A, typename = void>
+  struct CanResizeInPlace : std::false_type {};
+  template <typename A>
+  struct CanResizeInPlace<A, std::void_t<TryExpandCall<A>, ShrinkCall<A>>>
+      : std::true_type {};
+
+  /// Пытается расширить текущий буфер до new_capacity без переноса.
+  bool tryExpand(size_type new_capacity) {
+    if constexpr (CanResizeInPlace<Allocator>::value) {
+      if (data_ != nullptr &&
+          alloc_.try_expand(data_, capacity_, new_capacity)) {
+        capacity_ = new_capacity;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Уменьшает текущий буфер до new_capacity > 0 без переноса.
+  bool tryShrink(size_type new_capacity) {
+    if constexpr (CanResizeInPlace<Allocator>::value) {
+      if (data_ != nullptr && new_capacity > 0) {
+        alloc_.shrink(data_, capacity_, new_capacity);
+        capacity_ = new_capacity;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Емкость буфера при росте, когда нужно место под required элементов.
+  size_type growCapacity(size_type required) const {
+    return GrowthPolicy::next_capacity(size_, required, sizeof(value_type));
+  }
+
+  void destroyRange(value_type *first, value_type *last) {
+    vector_detail::destroyRange(alloc_, first, last);
+  }
+
+  /// Переносит [first, last) в неинициализированную память dst
+  /// (vector_detail::transfer).
+  void transfer(value_type *first, value_type *last, value_type *dst) {
+    vector_detail::transfer(alloc_, first, last, dst);
+  }
+
+  /// Освобождает текущий буфер и переходит на tmp емкостью new_capacity.
+  void replaceBuffer(value_type *tmp, size_type new_capacity) {
+    destroyRange(data_, data_ + size_);
+    deallocate(data_);
+    data_ = tmp;
+    capacity_ = new_capacity;
+  }
+
+  /**
+   * @brief Вставляет count элементов перед позицией index одним сдвигом.
+   *
+   * Если места не хватает, выделяется один новый буфер: fill(dst) создает
+   * новые элементы в нем, затем вокруг них переносятся старые, и при
+   * исключении вектор не меняется (vector_detail::insertRelocating). Иначе
+   * хвост сдвигается внутри буфера (vector_detail::insertInPlace, базовая
+   * гарантия).
+   *
+   * @param fill Создает count элементов в неинициализированной памяти dst и
+   * при исключении сам уничтожает уже созданные.
+   */
+  template <typename Fill>
+  iterator insertGap(size_type index, size_type count, Fill &&fill) {
+    if (count == 0) return data_ + index;
+    if (size_ + count > capacity_ && !tryExpand(growCapacity(size_ + count))) {
+      size_type new_capacity = growCapacity(size_ + count);
+      value_type *tmp = allocate(new_capacity);
+      try {
+        vector_detail::insertRelocating(alloc_, data_, size_, index, count,
+                                        tmp, fill);
+      } catch (...) {
+        AllocTraits::deallocate(alloc_, tmp, new_capacity);
+        throw;
+      }
+      replaceBuffer(tmp, new_capacity);
+      size_ += count;
+    } else {
+      vector_detail::insertInPlace(alloc_, data_, size_, index, count, fill);
+    }
+    return data_ + index;
+  }
+
+  /**
+   * @brief Общая часть resize: укорачивает вектор или растит его до n
+   * элементов, создавая новые функцией init(p).
+   */
+  template <typename Init>
+  void growTo(size_type n, Init init) {
+    if (n <= size_) {
+      destroyRange(data_ + n, data_ + size_);
+      size_ = n;
+      return;
+    }
+    if (n > capacity_) {
+      relocate(growCapacity(n));
+    }
+    for (; size_ < n; ++size_) {
+      init(data_ + size_);
+    }
+  }
+
+  /**
+   * @brief Переносит элементы в новый буфер емкостью new_capacity.
+   *
+   * Если аллокатор умеет менять размер буфера на месте, сначала пробуется
+   * это, и элементы остаются на своих адресах.
+   */
+  void relocate(size_type new_capacity) {
+    if (new_capacity > capacity_ && tryExpand(new_capacity)) return;
+    if (new_capacity < capacity_ && tryShrink(new_capacity)) return;
+    value_type *tmp = allocate(new_capacity);
+    try {
+      transfer(data_, data_ + size_, tmp);
+    } catch (...) {
+      AllocTraits::deallocate(alloc_, tmp, new_capacity);
+      throw;
+    }
+    replaceBuffer(tmp, new_capacity);
+  }
+
+  /**
+   * @brief Вставляет элемент в позицию index с ростом буфера.
+   *
+   * Новый элемент создается в новом буфере первым, затем вокруг него
+   * переносятся старые элементы. При исключении вектор не меняется.
+   */
+  template <typename... Args>
+  void reallocInsert(size_type index, Args &&...args) {
+    size_type new_capacity = growCapacity(size_ + 1);
+    value_type *tmp = allocate(new_capacity);
+    try {
+      AllocTraits::construct(alloc_, tmp + index, std::forward<Args>(args)...);
+      try {
+        transfer(data_, data_ + index, tmp);
+        try {
+          transfer(data_ + index, data_ + size_, tmp + index + 1);
+        } catch (...) {
+          destroyRange(tmp, tmp + index);
+          throw;
+        }
+      } catch (...) {
+        AllocTraits::destroy(alloc_, tmp + index);
+        throw;
+      }
+    } catch (...) {
+      AllocTraits::deallocate(alloc_, tmp, new_capacity);
+      throw;
+    }
+    replaceBuffer(tmp, new_capacity);
+    ++size_;
+  }
 };
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_VECTOR_H_
\ No newline at end of file
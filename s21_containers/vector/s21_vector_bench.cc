@@ -0,0 +1,103 @@
+// Бенчмарк push_back: s21::vector против std::vector для int,
+// std::string (перенос перемещением) и большого POD (перенос memcpy).
+// Вектор растет с нуля без reserve, так что замер включает все переносы.
+//
+// Второй замер - вставка 1000 элементов в середину вектора из [количество
+// элементов] int: поэлементно, диапазоном и count копиями.
+//
+// Запуск: ./bench.out [количество элементов]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "s21_vector.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct LargePod {
+  long fields[32];
+};
+
+template <typename Vector, typename Make>
+double Run(std::size_t size, Make make) {
+  auto start = Clock::now();
+  Vector vector;
+  for (std::size_t i = 0; i < size; ++i) {
+    vector.push_back(make(i));
+  }
+  double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  if (vector.size() != size) std::printf("size mismatch\n");
+  return static_cast<double>(size) / seconds / 1e6;
+}
+
+// Время в миллисекундах для вставки в середину заполненного вектора
+template <typename Vector, typename Insert>
+double TimeMiddleInsert(std::size_t size, Insert insert) {
+  Vector vector;
+  for (std::size_t i = 0; i < size; ++i) {
+    vector.push_back(static_cast<int>(i));
+  }
+  auto start = Clock::now();
+  insert(vector, size / 2);
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+template <typename T, typename Make>
+void Compare(const char *name, std::size_t size, Make make) {
+  double s21_rate = Run<s21::vector<T>>(size, make);
+  double std_rate = Run<std::vector<T>>(size, make);
+  std::printf("  %-12s %12.2f %12.2f\n", name, s21_rate, std_rate);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 22;
+
+  std::printf("%zu push_back calls, million ops/s\n", size);
+  std::printf("  %-12s %12s %12s\n", "type", "s21::vector", "std::vector");
+  Compare<int>("int", size, [](std::size_t i) { return static_cast<int>(i); });
+  Compare<std::string>("std::string", size / 4, [](std::size_t i) {
+    return std::string(32, static_cast<char>('a' + i % 26));
+  });
+  Compare<LargePod>("LargePod", size / 8, [](std::size_t i) {
+    LargePod pod{};
+    pod.fields[0] = static_cast<long>(i);
+    return pod;
+  });
+
+  const std::size_t kInserted = 1000;
+  std::vector<int> source(kInserted, 7);
+  std::printf("\n%zu ints inserted into the middle of %zu, ms\n", kInserted,
+              size);
+  std::printf("  %-30s %9.3f\n", "s21 insert() one by one",
+              TimeMiddleInsert<s21::vector<int>>(
+                  size, [&](s21::vector<int> &v, std::size_t mid) {
+                    for (int value : source) {
+                      v.insert(v.cbegin() + mid, value);
+                    }
+                  }));
+  std::printf("  %-30s %9.3f\n", "s21 insert(pos, first, last)",
+              TimeMiddleInsert<s21::vector<int>>(
+                  size, [&](s21::vector<int> &v, std::size_t mid) {
+                    v.insert(v.cbegin() + mid, source.begin(), source.end());
+                  }));
+  std::printf("  %-30s %9.3f\n", "s21 insert(pos, count, value)",
+              TimeMiddleInsert<s21::vector<int>>(
+                  size, [&](s21::vector<int> &v, std::size_t mid) {
+                    v.insert(v.cbegin() + mid, kInserted, 7);
+                  }));
+  std::printf("  %-30s %9.3f\n", "std insert(pos, first, last)",
+              TimeMiddleInsert<std::vector<int>>(
+                  size, [&](std::vector<int> &v, std::size_t mid) {
+                    v.insert(v.cbegin() + mid, source.begin(), source.end());
+                  }));
+  return 0;
+}
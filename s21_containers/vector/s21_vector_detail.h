@@ -0,0 +1,169 @@
+/**
+ * @file s21_vector_detail.h
+ * @brief Общие алгоритмы вставки для s21::vector, s21::small_vector и
+ * s21::static_vector.
+ *
+ * Все три контейнера хранят элементы подряд и вставляют count элементов
+ * одним сдвигом хвоста: либо внутри текущего буфера (insertInPlace), либо
+ * при переносе в новый буфер (insertRelocating). Элементы создаются и
+ * уничтожаются через std::allocator_traits; static_vector передает
+ * std::allocator, что сводится к placement new и вызову деструктора.
+ */
+
+#ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_VECTOR_DETAIL_H_
+#define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_VECTOR_DETAIL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+namespace vector_detail {
+
+/**
+ * @brief Лежит ли arg внутри элементов [first, last).
+ *
+ * Аргумент insert_many, ссылающийся на элемент контейнера, сдвиг хвоста
+ * переместит до того, как из него создадут новый элемент; такие аргументы
+ * сначала копируются во временные объекты.
+ */
+template <typename T, typename Arg>
+bool isElement(const Arg &arg, const T *first, const T *last) {
+  if constexpr (std::is_same_v<std::decay_t<Arg>, T>) {
+    std::less<const T *> less;
+    return !less(&arg, first) && less(&arg, last);
+  } else {
+    return false;
+  }
+}
+
+template <typename Alloc, typename T>
+void destroyRange(Alloc &alloc, T *first, T *last) {
+  for (; first != last; ++first) {
+    std::allocator_traits<Alloc>::destroy(alloc, first);
+  }
+}
+
+/**
+ * @brief Переносит элементы [first, last) в неинициализированную память
+ * dst.
+ *
+ * Тривиально копируемые типы переносятся одним memcpy. Остальные
+ * создаются аллокатором из std::move_if_noexcept(элемент): перемещаются,
+ * если перемещение не бросает исключений или копирование невозможно, иначе
+ * копируются, чтобы при исключении исходные элементы остались нетронутыми.
+ * При исключении уже созданные в dst элементы уничтожаются.
+ */
+template <typename Alloc, typename T>
+void transfer(Alloc &alloc, T *first, T *last, T *dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dst), first,
+                  static_cast<std::size_t>(last - first) * sizeof(T));
+    }
+  } else {
+    T *out = dst;
+    try {
+      for (; first != last; ++first, ++out) {
+        std::allocator_traits<Alloc>::construct(alloc, out,
+                                                std::move_if_noexcept(*first));
+      }
+    } catch (...) {
+      destroyRange(alloc, dst, out);
+      throw;
+    }
+  }
+}
+
+/**
+ * @brief Создает по элементу из каждого аргумента подряд начиная с dst.
+ * При исключении уже созданные элементы уничтожаются.
+ */
+template <typename Alloc, typename T, typename... Args>
+void constructEach(Alloc &alloc, T *dst, Args &&...args) {
+  T *out = dst;
+  [[maybe_unused]] auto put = [&alloc, &out](auto &&arg) {
+    std::allocator_traits<Alloc>::construct(alloc, out,
+                                            std::forward<decltype(arg)>(arg));
+    ++out;
+  };
+  try {
+    (put(std::forward<Args>(args)), ...);
+  } catch (...) {
+    destroyRange(alloc, dst, out);
+    throw;
+  }
+}
+
+/**
+ * @brief Вставляет count элементов перед index внутри буфера data из size
+ * элементов, где есть место еще под count.
+ *
+ * Хвост сдвигается один раз: часть попадает в неинициализированную память
+ * за концом, остальное перемещается присваиванием. Освободившиеся слоты
+ * уничтожаются и заполняются fill(data + index). Если fill бросает
+ * исключение, хвост уничтожается и size становится index (базовая
+ * гарантия).
+ *
+ * @param fill Создает count элементов в неинициализированной памяти dst и
+ * при исключении сам уничтожает уже созданные.
+ */
+template <typename Alloc, typename T, typename Fill>
+void insertInPlace(Alloc &alloc, T *data, std::size_t &size,
+                   std::size_t index, std::size_t count, Fill &fill) {
+  T *first = data + index;
+  T *last = data + size;
+  std::size_t raw = std::min(size - index, count);
+  for (T *src = last - raw; src != last; ++src) {
+    std::allocator_traits<Alloc>::construct(alloc, src + count,
+                                            std::move(*src));
+  }
+  std::move_backward(first, last - raw, last - raw + count);
+  destroyRange(alloc, first, first + raw);
+  try {
+    fill(first);
+  } catch (...) {
+    destroyRange(alloc, first + count, last + count);
+    size = index;
+    throw;
+  }
+  size += count;
+}
+
+/**
+ * @brief Создает в новом буфере tmp count элементов функцией
+ * fill(tmp + index) и переносит вокруг них элементы [data, data + size).
+ *
+ * При исключении tmp остается без элементов, а старый буфер не меняется;
+ * освободить tmp должен вызывающий. При успехе старые элементы еще не
+ * уничтожены.
+ */
+template <typename Alloc, typename T, typename Fill>
+void insertRelocating(Alloc &alloc, T *data, std::size_t size,
+                      std::size_t index, std::size_t count, T *tmp,
+                      Fill &fill) {
+  fill(tmp + index);
+  try {
+    transfer(alloc, data, data + index, tmp);
+    try {
+      transfer(alloc, data + index, data + size, tmp + index + count);
+    } catch (...) {
+      destroyRange(alloc, tmp, tmp + index);
+      throw;
+    }
+  } catch (...) {
+    destroyRange(alloc, tmp + index, tmp + index + count);
+    throw;
+  }
+}
+
+}  // namespace vector_detail
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_VECTOR_S21_VECTOR_DETAIL_H_
@@ -1,6 +1,21 @@
 #include "s21_vector.h"
 
 #include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_mmap_allocator.h"
 
 TEST(vector, Constructor_Default) {
   //создаем два объекта конструктором по умолчанию
@@ -203,6 +218,9 @@ TEST(vector, insert_many) {
   EXPECT_EQ(v1[3], 7);
   EXPECT_EQ(v1[4], 8);
   EXPECT_EQ(v1[5], 3);
+  // пустой набор аргументов ничего не вставляет
+  EXPECT_EQ(v1.insert_many(v1.cbegin() + 1), v1.begin() + 1);
+  EXPECT_EQ(v1.size(), 6U);
 }
 
 TEST(vector, insert_many_back) {
@@ -214,4 +232,388 @@ TEST(vector, insert_many_back) {
   EXPECT_EQ(v1[3], 6);
   EXPECT_EQ(v1[4], 7);
   EXPECT_EQ(v1[5], 8);
-}
\ No newline at end of file
+}
+
+namespace {
+
+// Считает копирования и перемещения при переносе элементов
+struct Counted {
+  static int copies;
+  static int moves;
+  int value;
+  explicit Counted(int v = 0) : value(v) {}
+  Counted(const Counted& other) : value(other.value) { ++copies; }
+  Counted(Counted&& other) noexcept : value(other.value) { ++moves; }
+  Counted& operator=(const Counted&) = default;
+  Counted& operator=(Counted&&) = default;
+};
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+// Перемещение может бросить исключение, поэтому при росте копируется
+struct ThrowingMove {
+  static int copies;
+  int value;
+  explicit ThrowingMove(int v = 0) : value(v) {}
+  ThrowingMove(const ThrowingMove& other) : value(other.value) { ++copies; }
+  ThrowingMove(ThrowingMove&& other) : value(other.value) {}
+};
+int ThrowingMove::copies = 0;
+
+// Бросает исключение при создании, когда countdown доходит до нуля
+struct Boom {
+  static int countdown;
+  static int live;
+  Boom() { Tick(); }
+  Boom(const Boom&) { Tick(); }
+  ~Boom() { --live; }
+  static void Tick() {
+    if (--countdown == 0) throw std::runtime_error("boom");
+    ++live;
+  }
+};
+int Boom::countdown = 0;
+int Boom::live = 0;
+
+// Считает неосвобожденные буферы
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  static inline int buffers = 0;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(std::size_t n) {
+    ++buffers;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) {
+    --buffers;
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const CountingAllocator&) const { return true; }
+  bool operator!=(const CountingAllocator&) const { return false; }
+};
+
+}  // namespace
+
+TEST(vector, reserve_moves_strings) {
+  s21::vector<std::string> strings;
+  for (int i = 0; i < 100; ++i) {
+    strings.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+  }
+  strings.reserve(1000);
+  EXPECT_EQ(strings.capacity(), 1000UL);
+  strings.shrink_to_fit();
+  EXPECT_EQ(strings.capacity(), 100UL);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(strings[i], std::string(40, static_cast<char>('a' + i % 26)));
+  }
+  s21::vector<std::string> copy(strings);
+  EXPECT_EQ(copy[99], strings[99]);
+}
+
+TEST(vector, reserve_uses_move_if_noexcept) {
+  Counted::copies = Counted::moves = 0;
+  s21::vector<Counted> counted;
+  for (int i = 0; i < 64; ++i) counted.push_back(Counted(i));
+  // push_back(T&&) перемещает аргумент, рост буфера (1+2+...+32 элемента)
+  // тоже только перемещает
+  EXPECT_EQ(Counted::copies, 0);
+  EXPECT_EQ(Counted::moves, 64 + 63);
+  EXPECT_EQ(counted[63].value, 63);
+
+  s21::vector<ThrowingMove> throwing;
+  for (int i = 0; i < 64; ++i) throwing.push_back(ThrowingMove(i));
+  EXPECT_EQ(ThrowingMove::copies, 63);
+  EXPECT_EQ(throwing[0].value, 0);
+}
+
+TEST(vector, reserve_memcpy_trivial) {
+  struct Pod {
+    int a;
+    double b;
+  };
+  s21::vector<Pod> pods;
+  for (int i = 0; i < 1000; ++i) pods.push_back(Pod{i, i * 0.5});
+  pods.shrink_to_fit();
+  EXPECT_EQ(pods.capacity(), 1000UL);
+  EXPECT_EQ(pods[999].a, 999);
+  EXPECT_DOUBLE_EQ(pods[999].b, 499.5);
+}
+
+TEST(vector, pmr_allocator) {
+  std::byte buffer[4096];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  using PmrAllocator = std::pmr::polymorphic_allocator<std::pmr::string>;
+  using PmrVector = s21::vector<std::pmr::string, PmrAllocator>;
+  PmrVector strings{PmrAllocator(&arena)};
+  for (int i = 0; i < 20; ++i) {
+    strings.push_back(std::pmr::string("short"));
+  }
+  // Элементы создаются аллокатором вектора и используют ту же арену
+  EXPECT_EQ(strings.get_allocator().resource(), &arena);
+  EXPECT_EQ(strings[19].get_allocator().resource(), &arena);
+  EXPECT_EQ(strings[0], "short");
+
+  // Без propagate_on_container_move_assignment элементы переносятся по
+  // одному в память целевого аллокатора
+  PmrVector other;
+  other = std::move(strings);
+  EXPECT_EQ(other.size(), 20UL);
+  EXPECT_EQ(other.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  EXPECT_EQ(other[5], "short");
+}
+
+TEST(vector, over_aligned_elements) {
+  struct alignas(64) Wide {
+    float lanes[16];
+  };
+  s21::vector<Wide> wides;
+  for (int i = 0; i < 33; ++i) {
+    Wide wide{};
+    wide.lanes[0] = static_cast<float>(i);
+    wides.push_back(wide);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(wides.data()) % 64, 0U);
+  }
+  EXPECT_FLOAT_EQ(wides[32].lanes[0], 32.0f);
+}
+
+TEST(vector, emplace_constructs_in_place) {
+  Counted::copies = Counted::moves = 0;
+  s21::vector<Counted> counted;
+  counted.reserve(8);
+  EXPECT_EQ(counted.emplace_back(1).value, 1);
+  counted.emplace_back(3);
+  counted.emplace(counted.cbegin() + 2, 4);
+  EXPECT_EQ(Counted::copies, 0);
+  EXPECT_EQ(Counted::moves, 0);
+  // Вставка в середину сдвигает хвост и перемещает созданный элемент
+  EXPECT_EQ(counted.emplace(counted.cbegin() + 1, 2)->value, 2);
+  EXPECT_EQ(Counted::copies, 0);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(counted[i].value, i + 1);
+  }
+}
+
+TEST(vector, emplace_self_reference) {
+  s21::vector<std::string> strings{"alpha", "beta"};
+  EXPECT_EQ(strings.capacity(), strings.size());
+  // Буфер полон: аргумент ссылается на элемент, который будет перенесен
+  strings.emplace_back(strings[0]);
+  strings.insert(strings.begin(), strings[2]);
+  strings.push_back(std::string(3, 'x'));
+  strings.emplace(strings.cbegin() + 1, strings.back());
+  const char* expected[] = {"alpha", "xxx", "alpha", "beta", "alpha", "xxx"};
+  ASSERT_EQ(strings.size(), 6UL);
+  for (std::size_t i = 0; i < strings.size(); ++i) {
+    EXPECT_EQ(strings[i], expected[i]);
+  }
+}
+
+TEST(vector, insert_many_forwards) {
+  Counted::copies = Counted::moves = 0;
+  s21::vector<Counted> counted;
+  counted.reserve(10);
+  counted.insert_many_back(1, 2, 5);
+  counted.insert_many(counted.cbegin() + 2, 3, 4);
+  EXPECT_EQ(Counted::copies, 0);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(counted[i].value, i + 1);
+  }
+
+  s21::vector<std::string> strings;
+  std::string moved(20, 'm');
+  strings.insert_many_back("literal", std::move(moved), std::string(2, 'y'));
+  EXPECT_EQ(strings[1], std::string(20, 'm'));
+  EXPECT_EQ(strings[2], "yy");
+}
+
+TEST(vector, range_and_count_insert) {
+  std::vector<std::string> std_vector{"a", "b", "c", "d"};
+  s21::vector<std::string> s21_vector{"a", "b", "c", "d"};
+  s21_vector.reserve(32);
+  std::vector<std::string> source{"x", "y", "z"};
+  // Хвост длиннее вставки, затем короче, затем вставка с ростом буфера
+  s21_vector.insert(s21_vector.cbegin() + 1, source.begin(), source.end());
+  std_vector.insert(std_vector.begin() + 1, source.begin(), source.end());
+  s21_vector.insert(s21_vector.cbegin() + 6, 4, std::string("q"));
+  std_vector.insert(std_vector.begin() + 6, 4, std::string("q"));
+  s21_vector.insert(s21_vector.cbegin() + 2, 30, s21_vector[0]);
+  std_vector.insert(std_vector.begin() + 2, 30, std_vector[0]);
+  auto it = s21_vector.insert(s21_vector.cend(), source.begin(), source.end());
+  std_vector.insert(std_vector.end(), source.begin(), source.end());
+  EXPECT_EQ(*it, "x");
+  ASSERT_EQ(s21_vector.size(), std_vector.size());
+  for (std::size_t i = 0; i < std_vector.size(); ++i) {
+    EXPECT_EQ(s21_vector[i], std_vector[i]);
+  }
+
+  // Однопроходный итератор
+  std::istringstream input("7 8 9");
+  s21::vector<int> numbers{1, 2, 3};
+  numbers.insert(numbers.cbegin() + 1, std::istream_iterator<int>(input),
+                 std::istream_iterator<int>());
+  int expected[] = {1, 7, 8, 9, 2, 3};
+  ASSERT_EQ(numbers.size(), 6UL);
+  for (std::size_t i = 0; i < numbers.size(); ++i) {
+    EXPECT_EQ(numbers[i], expected[i]);
+  }
+  numbers.insert(numbers.cbegin(), 0, 5);
+  EXPECT_EQ(numbers.size(), 6UL);
+}
+
+TEST(vector, insert_many_single_shift) {
+  s21::vector<std::string> strings{"a", "e"};
+  strings.reserve(16);
+  std::string* buffer = strings.data();
+  auto it = strings.insert_many(strings.cbegin() + 1, "b", std::string("c"),
+                                std::string(1, 'd'));
+  EXPECT_EQ(strings.data(), buffer);
+  EXPECT_EQ(it, strings.begin() + 4);
+  // Аргумент ссылается на элемент вектора
+  strings.insert_many(strings.cbegin(), strings[4], strings[0]);
+  const char* expected[] = {"e", "a", "a", "b", "c", "d", "e"};
+  ASSERT_EQ(strings.size(), 7UL);
+  for (std::size_t i = 0; i < strings.size(); ++i) {
+    EXPECT_EQ(strings[i], expected[i]);
+  }
+  strings.erase(strings.begin() + 1);
+  EXPECT_EQ(strings[1], "a");
+  EXPECT_EQ(strings.size(), 6UL);
+}
+
+TEST(vector, growth_policies) {
+  s21::vector<int, std::allocator<int>, s21::one_and_half_growth> slow;
+  std::size_t expected[] = {1, 2, 3, 4, 6, 9, 13, 19};
+  std::size_t step = 0;
+  for (int i = 0; i < 19; ++i) {
+    slow.push_back(i);
+    if (slow.size() == slow.capacity()) {
+      ASSERT_EQ(slow.capacity(), expected[step++]);
+    }
+  }
+  EXPECT_EQ(step, 8U);
+
+  s21::vector<char, std::allocator<char>, s21::page_aligned_growth<>> pages;
+  for (int i = 0; i < 5000; ++i) pages.push_back('x');
+  EXPECT_EQ(pages.capacity() % 4096, 0U);
+  struct Triple {
+    char bytes[3];
+  };
+  s21::vector<Triple, std::allocator<Triple>, s21::page_aligned_growth<>>
+      triples;
+  triples.resize(2000);
+  triples.push_back(Triple{});
+  // 2000 * 3 байта округляются до двух страниц
+  EXPECT_EQ(triples.capacity(), 8192U / sizeof(Triple));
+}
+
+TEST(vector, resize) {
+  s21::vector<std::string> strings;
+  strings.resize(3);
+  EXPECT_EQ(strings.size(), 3UL);
+  EXPECT_TRUE(strings[2].empty());
+  strings[0] = "keep";
+  strings.resize(6, strings[0]);
+  EXPECT_EQ(strings[5], "keep");
+  strings.resize(1);
+  EXPECT_EQ(strings.size(), 1UL);
+  EXPECT_EQ(strings[0], "keep");
+
+  s21::vector<int> zeros{1, 2};
+  zeros.resize(100);
+  EXPECT_EQ(zeros[1], 2);
+  EXPECT_EQ(zeros[99], 0);
+
+  // Буфер под чтение: элементы не обнуляются и сразу перезаписываются
+  const char source[] = "raw bytes from io";
+  s21::vector<char> buffer;
+  buffer.resize_uninitialized(sizeof(source));
+  std::memcpy(buffer.data(), source, sizeof(source));
+  EXPECT_EQ(buffer.size(), sizeof(source));
+  EXPECT_STREQ(buffer.data(), source);
+  buffer.resize_uninitialized(3);
+  EXPECT_EQ(buffer.size(), 3UL);
+}
+
+TEST(vector, mmap_allocator_grows_in_place) {
+  using Alloc = s21::mmap_allocator<std::uint64_t>;
+  // 16 МиБ резерва - 2 Ми элементов без переноса
+  s21::vector<std::uint64_t, Alloc> vector(Alloc(16 << 20, false));
+  vector.push_back(0);
+  const std::uint64_t *first = vector.data();
+  for (std::uint64_t i = 1; i < 1000000; ++i) {
+    vector.push_back(i);
+  }
+  EXPECT_EQ(vector.data(), first);
+  EXPECT_EQ(vector[999999], 999999U);
+  EXPECT_GE(Alloc::committed_bytes(first), 8000000U);
+
+  vector.resize(10);
+  vector.shrink_to_fit();
+  EXPECT_EQ(vector.data(), first);
+  EXPECT_EQ(vector.capacity(), 10UL);
+  EXPECT_LE(Alloc::committed_bytes(first), 2U * 4096U);
+  vector.push_back(10);
+  EXPECT_EQ(vector[10], 10U);
+
+  // Резерв исчерпан - обычный перенос в новый буфер
+  vector.reserve(3 << 20);
+  EXPECT_NE(vector.data(), first);
+  EXPECT_EQ(vector.size(), 11UL);
+  EXPECT_EQ(vector[9], 9U);
+
+  s21::vector<std::string, s21::mmap_allocator<std::string>> strings;
+  for (int i = 0; i < 1000; ++i) {
+    strings.emplace_back(40, static_cast<char>('a' + i % 26));
+  }
+  strings.insert(strings.cbegin(), 10, "x");
+  EXPECT_EQ(strings[10], std::string(40, 'a'));
+  EXPECT_EQ(strings.size(), 1010UL);
+}
+
+TEST(vector, mmap_allocator_huge_pages_are_aligned) {
+  using Alloc = s21::mmap_allocator<char>;
+  EXPECT_FALSE(Alloc().huge_pages());
+  EXPECT_EQ(Alloc().reservation(), std::size_t{1} << 30);
+
+  const std::size_t kHuge = Alloc::kHugePageSize;
+  const std::size_t kPage = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  s21::vector<char, Alloc> vector(Alloc(64 << 20, true));
+  vector.resize(100);
+  // данные начинаются на границе большой страницы и подключаются ими же
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.data()) % kHuge, 0U);
+  EXPECT_EQ(Alloc::committed_bytes(vector.data()), kPage + kHuge);
+  const char *first = vector.data();
+  vector.resize(kHuge + 1, 'x');
+  EXPECT_EQ(vector.data(), first);
+  EXPECT_EQ(Alloc::committed_bytes(first), kPage + 2 * kHuge);
+  EXPECT_EQ(vector[kHuge], 'x');
+  vector.resize(10);
+  vector.shrink_to_fit();
+  EXPECT_EQ(Alloc::committed_bytes(first), kPage + kHuge);
+}
+
+TEST(vector, constructor_cleans_up_after_throw) {
+  using Vector = s21::vector<Boom, CountingAllocator<Boom>>;
+  Boom::countdown = 3;
+  EXPECT_THROW(Vector(5), std::runtime_error);
+  EXPECT_EQ(Boom::live, 0);
+  EXPECT_EQ(CountingAllocator<Boom>::buffers, 0);
+
+  Boom::countdown = 0;
+  Vector source(4);
+  Boom::countdown = 3;
+  EXPECT_THROW(Vector copy(source), std::runtime_error);
+  std::initializer_list<Boom> items{Boom(), Boom()};
+  Boom::countdown = 2;
+  EXPECT_THROW(Vector{items}, std::runtime_error);
+  Boom::countdown = 0;
+  EXPECT_EQ(Boom::live, 6);
+  EXPECT_EQ(CountingAllocator<Boom>::buffers, 1);
+}